@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include "sync_drift.h"
+
+#define Q16(x)       ((int64_t)(x) * 65536)
+#define Q16_ROUND(x) ((int32_t)(((x) + 0x8000) >> 16))
+
+static int64_t abs64(int64_t v)
+{
+	return (v < 0) ? -v : v;
+}
+
+static void sync_drift_reacquire(struct sync_drift *drift, uint32_t capture)
+{
+	drift->next = (uint64_t)Q16(capture) + (uint64_t)drift->period;
+	drift->offset = 0;
+	drift->in_lock = 0;
+	drift->outliers = 0;
+}
+
+void sync_drift_init(struct sync_drift *drift, uint32_t nominal_period)
+{
+	drift->nominal = Q16(nominal_period);
+	drift->period = drift->nominal;
+	drift->max_dev = (drift->nominal * SYNC_DRIFT_MAX_PPM_DEFAULT) / 1000000;
+	drift->next = 0;
+	drift->offset = 0;
+	drift->kp_shift = SYNC_DRIFT_KP_SHIFT_DEFAULT;
+	drift->ki_shift = SYNC_DRIFT_KI_SHIFT_DEFAULT;
+	drift->started = false;
+	drift->in_lock = 0;
+	drift->outliers = 0;
+	drift->updates = 0;
+	drift->missed = 0;
+	drift->rejected = 0;
+}
+
+void sync_drift_set_gains(struct sync_drift *drift, uint8_t kp_shift, uint8_t ki_shift)
+{
+	drift->kp_shift = kp_shift;
+	drift->ki_shift = ki_shift;
+}
+
+void sync_drift_update(struct sync_drift *drift, uint32_t capture)
+{
+	int64_t err, half, n;
+	bool clamped;
+
+	if (drift->nominal == 0) {
+		return;
+	}
+
+	if (!drift->started) {
+		sync_drift_reacquire(drift, capture);
+		drift->started = true;
+		drift->updates++;
+		return;
+	}
+
+	/* phase error in Q16, the integer part is taken modulo 2^32 */
+	err = Q16((int32_t)(capture - (uint32_t)(drift->next >> 16))) -
+	      (int64_t)(drift->next & 0xFFFFU);
+	half = drift->period / 2;
+
+	if (err < -half) {
+		drift->rejected++;
+		return;
+	}
+
+	if (err >= half) {
+		n = (err + half) / drift->period;
+		drift->next += (uint64_t)(n * drift->period);
+		err -= n * drift->period;
+		drift->missed += (uint32_t)n;
+	}
+
+	if (abs64(err) > drift->period / 4) {
+		/* a glitch is skipped, a lasting phase step is reacquired */
+		drift->in_lock = 0;
+		if (++drift->outliers >= SYNC_DRIFT_MAX_OUTLIERS) {
+			sync_drift_reacquire(drift, capture);
+		} else {
+			drift->next += (uint64_t)drift->period;
+		}
+		return;
+	}
+	drift->outliers = 0;
+
+	/* PI loop: correct this event's phase, then the period */
+	clamped = true;
+	drift->period += err >> drift->ki_shift;
+	if (drift->period > drift->nominal + drift->max_dev) {
+		drift->period = drift->nominal + drift->max_dev;
+	} else if (drift->period < drift->nominal - drift->max_dev) {
+		drift->period = drift->nominal - drift->max_dev;
+	} else {
+		clamped = false;
+	}
+	drift->next += (uint64_t)((err >> drift->kp_shift) + drift->period);
+
+	drift->offset += (err - drift->offset) >> 3;
+
+	/* at the pull range the phase loop hides a standing error, no lock */
+	if (!clamped && abs64(err) < drift->period / SYNC_DRIFT_LOCK_DIV) {
+		if (drift->in_lock < SYNC_DRIFT_LOCK_COUNT) {
+			drift->in_lock++;
+		}
+	} else {
+		drift->in_lock = 0;
+	}
+
+	drift->updates++;
+}
+
+void sync_drift_get(const struct sync_drift *drift, struct sync_drift_result *result)
+{
+	if (drift->nominal == 0) {
+		result->ppb = 0;
+		result->offset = 0;
+		result->period = 0;
+		result->locked = false;
+		return;
+	}
+
+	/* split the 10^9 so the product stays in range for any period */
+	result->ppb = (int32_t)(((drift->period - drift->nominal) * 1000000) /
+				(drift->nominal / 1000));
+	result->offset = Q16_ROUND(drift->offset);
+	result->period = (uint32_t)Q16_ROUND(drift->period);
+	result->locked = (drift->in_lock >= SYNC_DRIFT_LOCK_COUNT);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _SYNC_DRIFT_H
+#define _SYNC_DRIFT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file sync_drift.h
+ *
+ * @brief Drift estimator for periodic capture events, e.g. ISO events captured by the sync
+ *        timer. A second order PLL tracks the event phase and period in local timer ticks.
+ *        The period estimate, relative to the nominal period, gives the drift in ppb. The
+ *        filtered phase error gives the offset of the events from the tracked grid.
+ *
+ *        Captures are raw 32 bit counter values, events must be less than 2^31 ticks apart.
+ *        A capture more than half a period late is taken as missed events, one more than half
+ *        a period early is rejected. No hardware access, the estimator runs on the host.
+ */
+
+/** Loop gain shifts, a phase error e moves the phase by e >> kp and the period by e >> ki */
+#define SYNC_DRIFT_KP_SHIFT_DEFAULT 2
+#define SYNC_DRIFT_KI_SHIFT_DEFAULT 5
+
+/** Pull range, the period estimate is clamped to nominal +- this */
+#define SYNC_DRIFT_MAX_PPM_DEFAULT 1000
+
+/**
+ * Consecutive captures within SYNC_DRIFT_LOCK_DIV of a period needed to report lock. No lock
+ * is reported while the period estimate sits at the pull range.
+ */
+#define SYNC_DRIFT_LOCK_COUNT 8
+#define SYNC_DRIFT_LOCK_DIV   64
+
+/** Consecutive captures beyond a quarter period before the phase is reacquired */
+#define SYNC_DRIFT_MAX_OUTLIERS 4
+
+/**
+ * @brief Estimator state. All fixed point values are Q16 ticks.
+ */
+struct sync_drift {
+	int64_t nominal;   /**< nominal period, 0 when not configured */
+	int64_t period;    /**< tracked period */
+	int64_t max_dev;   /**< pull range around nominal */
+	uint64_t next;     /**< predicted capture, low 32 integer bits are used */
+	int64_t offset;    /**< filtered phase error */
+	uint8_t kp_shift;
+	uint8_t ki_shift;
+	bool started;      /**< first capture seen */
+	uint8_t in_lock;   /**< consecutive captures near the prediction */
+	uint8_t outliers;  /**< consecutive captures far from the prediction */
+	uint32_t updates;  /**< captures used */
+	uint32_t missed;   /**< events inferred as missed */
+	uint32_t rejected; /**< early captures dropped */
+};
+
+/**
+ * @brief Drift estimate snapshot
+ */
+struct sync_drift_result {
+	int32_t ppb;     /**< local ticks per event vs nominal, parts per billion */
+	int32_t offset;  /**< filtered capture phase error, ticks */
+	uint32_t period; /**< tracked period, ticks */
+	bool locked;     /**< estimate has settled */
+};
+
+/**
+ * @brief  Reset the estimator for a new event stream
+ *
+ * @param drift           Estimator state
+ * @param nominal_period  Nominal event period in timer ticks, 0 idles the estimator
+ */
+void sync_drift_init(struct sync_drift *drift, uint32_t nominal_period);
+
+/**
+ * @brief  Change the loop gains, larger shifts filter more and settle slower
+ *
+ * @param drift     Estimator state
+ * @param kp_shift  Phase gain shift
+ * @param ki_shift  Period gain shift, must be larger than kp_shift for a stable loop
+ */
+void sync_drift_set_gains(struct sync_drift *drift, uint8_t kp_shift, uint8_t ki_shift);
+
+/**
+ * @brief  Feed one capture
+ *
+ * @param drift    Estimator state
+ * @param capture  Raw 32 bit timer value of the event
+ */
+void sync_drift_update(struct sync_drift *drift, uint32_t capture);
+
+/**
+ * @brief  Read the current estimate
+ *
+ * @param drift   Estimator state
+ * @param result  Estimate
+ */
+void sync_drift_get(const struct sync_drift *drift, struct sync_drift_result *result);
+
+#endif /* _SYNC_DRIFT_H */
@@ -4,63 +4,28 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include "cmsis_compiler.h"
 #include "sync_timer.h"
+#include "sync_drift.h"
+#include <zephyr/devicetree.h>
 #include <zephyr/irq.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
 #include "utimer.h"
+#include "evtrtr.h"
 
 LOG_MODULE_REGISTER(iso_sync_timer);
 
-#define EVTRTR_BASE     0x400E2000
-#define EVTRTR_DMA_CTRL ((uint32_t volatile *)EVTRTR_BASE)
-
-#define EVTRTR_SELECT_GROUP_0 0x0
-#define EVTRTR_SELECT_GROUP_1 0x1
-#define EVTRTR_SELECT_GROUP_2 0x2
-#define EVTRTR_SELECT_GROUP_3 0x3
+#define DT_DRV_COMPAT alif_iso_sync_timer
 
 static void (*sync_timer_cap_cb)(void);
 static void (*sync_timer_ovf_cb)(void);
 
 /* UTIMER definitions */
-#define UTIMER_BASE    0x48000000u
-#define UTIMER_CHAN(n) ((utimer_chan_t *)(UTIMER_BASE + 0x1000u * ((n) + 1u)))
-
-#define UTIMER_SRC_TRIG0_RISING   ((uint32_t)0x00000001u)
-#define UTIMER_SRC_TRIG0_FALLING  ((uint32_t)0x00000002u)
-#define UTIMER_SRC_TRIG1_RISING   ((uint32_t)0x00000004u)
-#define UTIMER_SRC_TRIG1_FALLING  ((uint32_t)0x00000008u)
-#define UTIMER_SRC_TRIG2_RISING   ((uint32_t)0x00000010u)
-#define UTIMER_SRC_TRIG2_FALLING  ((uint32_t)0x00000020u)
-#define UTIMER_SRC_TRIG3_RISING   ((uint32_t)0x00000040u)
-#define UTIMER_SRC_TRIG3_FALLING  ((uint32_t)0x00000080u)
-#define UTIMER_SRC_TRIG4_RISING   ((uint32_t)0x00000100u)
-#define UTIMER_SRC_TRIG4_FALLING  ((uint32_t)0x00000200u)
-#define UTIMER_SRC_TRIG5_RISING   ((uint32_t)0x00000400u)
-#define UTIMER_SRC_TRIG5_FALLING  ((uint32_t)0x00000800u)
-#define UTIMER_SRC_TRIG6_RISING   ((uint32_t)0x00001000u)
-#define UTIMER_SRC_TRIG6_FALLING  ((uint32_t)0x00002000u)
-#define UTIMER_SRC_TRIG7_RISING   ((uint32_t)0x00004000u)
-#define UTIMER_SRC_TRIG7_FALLING  ((uint32_t)0x00008000u)
-#define UTIMER_SRC_TRIG8_RISING   ((uint32_t)0x00010000u)
-#define UTIMER_SRC_TRIG8_FALLING  ((uint32_t)0x00020000u)
-#define UTIMER_SRC_TRIG9_RISING   ((uint32_t)0x00040000u)
-#define UTIMER_SRC_TRIG9_FALLING  ((uint32_t)0x00080000u)
-#define UTIMER_SRC_TRIG10_RISING  ((uint32_t)0x00100000u)
-#define UTIMER_SRC_TRIG10_FALLING ((uint32_t)0x00200000u)
-#define UTIMER_SRC_TRIG11_RISING  ((uint32_t)0x00400000u)
-#define UTIMER_SRC_TRIG11_FALLING ((uint32_t)0x00800000u)
-#define UTIMER_SRC_TRIG12_RISING  ((uint32_t)0x01000000u)
-#define UTIMER_SRC_TRIG12_FALLING ((uint32_t)0x02000000u)
-#define UTIMER_SRC_TRIG13_RISING  ((uint32_t)0x04000000u)
-#define UTIMER_SRC_TRIG13_FALLING ((uint32_t)0x08000000u)
-#define UTIMER_SRC_TRIG14_RISING  ((uint32_t)0x10000000u)
-#define UTIMER_SRC_TRIG14_FALLING ((uint32_t)0x20000000u)
-#define UTIMER_SRC_TRIG15_RISING  ((uint32_t)0x40000000u)
-#define UTIMER_SRC_TRIG15_FALLING ((uint32_t)0x80000000u)
+#define UTIMER_BASE 0x48000000u
 
 #define UTIMER_IRQ_BASE           377u
 #define UTIMER_CAPTURE_A_IRQ_BASE (UTIMER_IRQ_BASE + 0)
@@ -69,166 +34,160 @@ static void (*sync_timer_ovf_cb)(void);
 #define UTIMER_CAPTURE_A_IRQ(chan) (UTIMER_CAPTURE_A_IRQ_BASE + ((chan) * 8u))
 #define UTIMER_OVERFLOW_IRQ(chan)  (UTIMER_OVERFLOW_IRQ_BASE + ((chan) * 8u))
 
-/* UTIMER bit mask */
-#define UTIMER_CAPTURE_A_BIT_MASK ((uint32_t)0x00000001u)
-#define UTIMER_OVERFLOW_BIT_MASK  ((uint32_t)0x00000080u)
-
-/* ISO event configuration */
+/* ISO event configuration, used when the devicetree has no alif,iso-sync-timer node */
+#define ISO_EVT_EVTRTR              EVTRTR_2
 #define ISO_EVT_EVTRTR_CHAN         8u
-#define ISO_EVT_EVTRTR_GROUP        EVTRTR_SELECT_GROUP_2
+#define ISO_EVT_EVTRTR_GROUP        2u
 #define ISO_EVT_UTIMER_CHAN         0u
-#define ISO_EVT_UTIMER_TRIG         UTIMER_SRC_TRIG8_RISING
-#define ISO_EVT_UTIMER_CAP_A_IRQ    UTIMER_CAPTURE_A_IRQ(ISO_EVT_UTIMER_CHAN)
-#define ISO_EVT_UTIMER_OVF_IRQ      UTIMER_OVERFLOW_IRQ(ISO_EVT_UTIMER_CHAN)
 #define ISO_EVT_UTIMER_OVF_IRQ_PRIO 3
 #define ISO_EVT_UTIMER_CAP_IRQ_PRIO 4
 
 /**
- * UTIMER channel registers.
+ * Sync timer instance. Instance 0 serves the BLE host stack callbacks, every instance keeps a
+ * drift estimate of its capture events.
  */
-typedef struct {
-	uint32_t volatile cntr_start0_src;     /**< Counter Start Source 0 Register >*/
-	uint32_t volatile cntr_start1_src;     /**< Counter Start Source 1 Register >*/
-	uint32_t volatile cntr_stop0_src;      /**< Counter Stop Source 0 Register >*/
-	uint32_t volatile cntr_stop1_src;      /**< Counter Stop Source 1 Register >*/
-	uint32_t volatile cntr_clear0_src;     /**< Counter Clear Source 0 Register >*/
-	uint32_t volatile cntr_clear1_src;     /**< Counter Clear Source 1 Register >*/
-	uint32_t volatile cntr_up0_src;        /**< Counter Up Source 0 Register >*/
-	uint32_t volatile cntr_up1_src;        /**< Counter Up Source 1 Register >*/
-	uint32_t volatile cntr_down0_src;      /**< Counter Down Source 0 Register >*/
-	uint32_t volatile cntr_down1_src;      /**< Counter Down Source 1 Register >*/
-	uint32_t volatile trig_capture_src_a0; /**< Trigger Capture Source A 0 Register >*/
-	uint32_t volatile trig_capture_src_a1; /**< Trigger Capture Source A 1 Register >*/
-	uint32_t volatile trig_capture_src_b0; /**< Trigger Capture Source B 0 Register >*/
-	uint32_t volatile trig_capture_src_b1; /**< Trigger Capture Source B 1 Register >*/
-	uint32_t volatile reserved1[18];       /**< Reserved Registers*/
-	uint32_t volatile cntr_ctrl;           /**< Counter Control Register >*/
-	uint32_t volatile reserved2[2];        /**< Reserved Registers >*/
-	uint32_t volatile compare_ctrl_a;      /**< Compare Control A Register >*/
-	uint32_t volatile compare_ctrl_b;      /**< Compare Control B Register >*/
-	uint32_t volatile buf_op_ctrl;         /**< Buffer Op Control Register >*/
-	uint32_t volatile reserved3[2];        /**< Reserved Registers >*/
-	uint32_t volatile cntr;                /**< Counter Register >*/
-	uint32_t volatile cntr_ptr;            /**< Counter Pointer Register >*/
-	uint32_t volatile cntr_ptr_buf1;       /**< Counter Pointer Buffer 1 Register >*/
-	uint32_t volatile cntr_ptr_buf2;       /**< Counter Pointer Buffer 2 Register >*/
-	uint32_t volatile capture_a;           /**< Capture A Register >*/
-	uint32_t volatile capture_a_buf1;      /**< Capture A Buffer 1 Register >*/
-	uint32_t volatile capture_a_buf2;      /**< Capture A Buffer 2 Register >*/
-	uint32_t volatile reserved4;           /**< Reserved Registers >*/
-	uint32_t volatile capture_b;           /**< Capture B Register >*/
-	uint32_t volatile capture_b_buf1;      /**< Capture B Buffer 1 Register >*/
-	uint32_t volatile capture_b_buf2;      /**< Capture B Buffer 2 Register >*/
-	uint32_t volatile reserved5;           /**< Reserved Registers >*/
-	uint32_t volatile compare_a;           /**< Compare A Register >*/
-	uint32_t volatile compare_a_buf1;      /**< Compare A Buffer 1 Register >*/
-	uint32_t volatile compare_a_buf2;      /**< Compare A Buffer 2 Register >*/
-	uint32_t volatile reserved6;           /**< Reserved Registers >*/
-	uint32_t volatile compare_b;           /**< Compare B Register >*/
-	uint32_t volatile compare_b_buf1;      /**< Compare B Buffer 1 Register >*/
-	uint32_t volatile compare_b_buf2;      /**< Compare B Buffer 2 Register >*/
-	uint32_t volatile reserved7;           /**< Reserved Registers >*/
-	uint32_t volatile dead_time_up;        /**< Dead time up Register >*/
-	uint32_t volatile dead_time_up_buf;    /**< Dead time up Buffer Register >*/
-	uint32_t volatile dead_time_down;      /**< Dead time down Register >*/
-	uint32_t volatile dead_time_down_buf;  /**< Dead time up Buffer Register >*/
-	uint32_t volatile reserved8[5];        /**< Reserved Registers >*/
-	uint32_t volatile chan_status;         /**< Channel Status Register >*/
-	uint32_t volatile chan_interrupt;      /**< Channel interrupt Control >*/
-	uint32_t volatile chan_interrupt_mask; /**< Channel Interrupt Mask Register >*/
-	uint32_t volatile duty_cycle_ctrl;     /**< Duty cycle control register >*/
-	uint32_t volatile dead_time_ctrl;      /**< Dead Control Register >*/
-	uint32_t volatile reserved9[950];      /**< Reserved Registers >*/
-} utimer_chan_t;
-
-typedef struct {
-	volatile uint32_t glb_cntr_start;   /**< Global Counter Start Register >*/
-	volatile uint32_t glb_cntr_stop;    /**< Global Counter Stop Register >*/
-	volatile uint32_t glb_cntr_clear;   /**< Global Counter Clear Register >*/
-	volatile uint32_t glb_cntr_running; /**< Global Counter Running Status Register >*/
-	volatile uint32_t glb_driver_oen;   /**< Channel Driver oen Register >*/
-} TIMER_RegInfo;
+struct sync_timer_inst {
+	uint8_t utimer_chan;
+	uint8_t evtrtr_chan;
+	uint8_t evtrtr_group;
+	uint32_t cap_irq;
+	uint32_t ovf_irq;
+	struct sync_drift drift;
+};
+
+#if DT_HAS_COMPAT_STATUS_OKAY(DT_DRV_COMPAT)
+
+#define SYNC_TIMER_INST(n)                                                                         \
+	[n] = {                                                                                    \
+		.utimer_chan = DT_INST_PROP(n, utimer_channel),                                    \
+		.evtrtr_chan = DT_INST_PROP(n, evtrtr_channel),                                    \
+		.evtrtr_group = DT_INST_PROP(n, evtrtr_group),                                     \
+		.cap_irq = UTIMER_CAPTURE_A_IRQ(DT_INST_PROP(n, utimer_channel)),                  \
+		.ovf_irq = UTIMER_OVERFLOW_IRQ(DT_INST_PROP(n, utimer_channel)),                   \
+	},
+
+static struct sync_timer_inst sync_timers[] = {DT_INST_FOREACH_STATUS_OKAY(SYNC_TIMER_INST)};
+
+#define SYNC_TIMER_IRQ_CONNECT(n)                                                                  \
+	IRQ_CONNECT(UTIMER_OVERFLOW_IRQ(DT_INST_PROP(n, utimer_channel)),                          \
+		    DT_INST_PROP(n, overflow_irq_priority), overflow_irq_handler, &sync_timers[n], \
+		    0);                                                                            \
+	IRQ_CONNECT(UTIMER_CAPTURE_A_IRQ(DT_INST_PROP(n, utimer_channel)),                         \
+		    DT_INST_PROP(n, capture_irq_priority), capture_irq_handler, &sync_timers[n],   \
+		    0);
 
-static void overflow_irq_handler(const void *context)
+#else
+
+static struct sync_timer_inst sync_timers[] = {
+	{
+		.utimer_chan = ISO_EVT_UTIMER_CHAN,
+		.evtrtr_chan = ISO_EVT_EVTRTR_CHAN,
+		.evtrtr_group = ISO_EVT_EVTRTR_GROUP,
+		.cap_irq = UTIMER_CAPTURE_A_IRQ(ISO_EVT_UTIMER_CHAN),
+		.ovf_irq = UTIMER_OVERFLOW_IRQ(ISO_EVT_UTIMER_CHAN),
+	},
+};
+
+#endif
+
+#define SYNC_TIMER_COUNT ARRAY_SIZE(sync_timers)
+
+static inline uint32_t sync_timer_chan_base(const struct sync_timer_inst *inst)
 {
-	(void)context;
+	return UTIMER_CHAN_BASE(UTIMER_BASE, inst->utimer_chan);
+}
 
-	/* LOG_DBG("ISO sync timer overflow IRQ handler"); */
+static void overflow_irq_handler(const void *context)
+{
+	const struct sync_timer_inst *inst = context;
+	uint32_t base = sync_timer_chan_base(inst);
 
 	/* Clear OVERFLOW IRQ */
-	UTIMER_CHAN(ISO_EVT_UTIMER_CHAN)->chan_interrupt |= UTIMER_OVERFLOW_BIT_MASK;
-	(void)UTIMER_CHAN(ISO_EVT_UTIMER_CHAN)->chan_interrupt;
+	alif_utimer_ack_interrupts(base, CHAN_INTERRUPT_OVER_FLOW);
+	(void)alif_utimer_get_pending_interrupt(base);
 
-	if (sync_timer_ovf_cb) {
+	if (inst == &sync_timers[0] && sync_timer_ovf_cb) {
 		sync_timer_ovf_cb();
 	}
 }
 
 static void capture_irq_handler(const void *context)
 {
-	(void)context;
-
-	/* LOG_DBG("ISO sync timer capture IRQ handler"); */
+	struct sync_timer_inst *inst = (struct sync_timer_inst *)context;
+	uint32_t base = sync_timer_chan_base(inst);
 
 	/* Clear CAPTURE A IRQ */
-	UTIMER_CHAN(ISO_EVT_UTIMER_CHAN)->chan_interrupt |= UTIMER_CAPTURE_A_BIT_MASK;
-	(void)UTIMER_CHAN(ISO_EVT_UTIMER_CHAN)->chan_interrupt;
+	alif_utimer_ack_interrupts(base, CHAN_INTERRUPT_CAPTURE_A);
+	(void)alif_utimer_get_pending_interrupt(base);
 
-	if (sync_timer_cap_cb) {
+	sync_drift_update(&inst->drift, alif_utimer_get_capture_value(base, 0));
+
+	if (inst == &sync_timers[0] && sync_timer_cap_cb) {
 		sync_timer_cap_cb();
 	}
 }
 
-int32_t sync_timer_init(void)
+static int32_t sync_timer_inst_init(struct sync_timer_inst *inst)
 {
-	/* Enable clock for DMA2 and EVTRTR2 */
-	mem_addr_t reg = 0x43007010;
-	uint32_t orig = sys_read32(reg);
-	uint32_t new = orig | 0x10;
-
-	sys_write32(new, reg);
+	struct utimer_channel_config ch = {0};
+	uint32_t base = sync_timer_chan_base(inst);
+	int32_t ret;
 
 	/*
 	 * Set up event router to generate a global event on the rising edge of the
-	 * ISO GPIO 0 signal indicating an event occurs on an ISO over shared memory
+	 * ISO GPIO signal indicating an event occurs on an ISO over shared memory
 	 * data path.
 	 */
-	EVTRTR_DMA_CTRL[ISO_EVT_EVTRTR_CHAN] = ISO_EVT_EVTRTR_GROUP;
+	ret = alif_evtrtr_connect(ISO_EVT_EVTRTR, inst->evtrtr_chan, inst->evtrtr_group, 0);
+	if (ret) {
+		LOG_ERR("ISO event router channel %u unavailable (%d)", inst->evtrtr_chan, ret);
+		return ret;
+	}
 
 	/*
-	 * There is no interrupt on the M55 directly associated with the ISO GPIO 0
-	 * so we use instead the ISO GPIO 0 event to indirectly raise an interrupt
+	 * There is no interrupt on the M55 directly associated with the ISO GPIO
+	 * so we use instead the ISO GPIO event to indirectly raise an interrupt
 	 * by triggering a capture on a dedicated UTIMER channel.
 	 */
-	sys_set_bit(UTIMER_GLB_CLOCK_ENABLE(0x48000000), ISO_EVT_UTIMER_CHAN);
+	alif_utimer_enable_timer_clock(UTIMER_BASE, inst->utimer_chan);
 
-	utimer_chan_t *utimer_chan = UTIMER_CHAN(ISO_EVT_UTIMER_CHAN);
+	/* Capture timer value when the ISO GPIO is triggered on CAPTURE_A */
+	sys_write32(CNTR_SRC0_TRIG_RISING(inst->evtrtr_chan), UTIMER_TRIG_CAPTURE_SRC_A_0(base));
+	sys_write32(0, UTIMER_TRIG_CAPTURE_SRC_A_1(base));
 
-	/* Capture timer value when GPIO 0 is triggered on CAPTURE_A */
-	utimer_chan->trig_capture_src_a0 = ISO_EVT_UTIMER_TRIG;
-	utimer_chan->trig_capture_src_a1 = 0x00000000u;
-	utimer_chan->chan_interrupt_mask = ~(UTIMER_CAPTURE_A_BIT_MASK);
+	/* Free running up counter, started through the global registers */
+	ch.cntr_ctrl = CNTR_CTRL_SAWTOOTH;
+	ch.reload = UINT32_MAX;
+	ch.counter = 0;
+	ch.int_mask = ~(CHAN_INTERRUPT_CAPTURE_A | CHAN_INTERRUPT_OVER_FLOW);
+	ch.soft_ctrl = true;
+	alif_utimer_config_channel(base, &ch);
 
-	/* Power on the counter */
-	utimer_chan->cntr_start1_src = 0x80000000u; /* global programmatic start enabled */
-	utimer_chan->cntr_stop1_src = 0x80000000u;  /* global programmatic stop enabled */
-	utimer_chan->cntr_clear1_src = 0x80000000u; /* global programmatic clear enabled */
+	sync_drift_init(&inst->drift, 0);
 
-	/* UP counter configuration */
-	utimer_chan->cntr_ptr = UINT32_MAX;   /* Max count value */
-	utimer_chan->cntr = 0x00000000u;      /* Start count value */
-	utimer_chan->cntr_ctrl = 0x00000001u; /* Start up counter */
+	return 0;
+}
 
-	/* Enable overflow interrupt */
-	utimer_chan->chan_interrupt_mask &= ~(UTIMER_OVERFLOW_BIT_MASK);
+int32_t sync_timer_init(void)
+{
+	int32_t ret;
 
-	/* Connect IRQs */
-	IRQ_CONNECT(ISO_EVT_UTIMER_OVF_IRQ, ISO_EVT_UTIMER_OVF_IRQ_PRIO, overflow_irq_handler, 0,
-		    0);
-	IRQ_CONNECT(ISO_EVT_UTIMER_CAP_A_IRQ, ISO_EVT_UTIMER_CAP_IRQ_PRIO, capture_irq_handler, 0,
-		    0);
+	for (size_t i = 0; i < SYNC_TIMER_COUNT; i++) {
+		ret = sync_timer_inst_init(&sync_timers[i]);
+		if (ret) {
+			return ret;
+		}
+	}
 
-	/* LOG_DBG("ISO sync timer initialised"); */
+	/* Connect IRQs */
+#if DT_HAS_COMPAT_STATUS_OKAY(DT_DRV_COMPAT)
+	DT_INST_FOREACH_STATUS_OKAY(SYNC_TIMER_IRQ_CONNECT)
+#else
+	IRQ_CONNECT(UTIMER_OVERFLOW_IRQ(ISO_EVT_UTIMER_CHAN), ISO_EVT_UTIMER_OVF_IRQ_PRIO,
+		    overflow_irq_handler, &sync_timers[0], 0);
+	IRQ_CONNECT(UTIMER_CAPTURE_A_IRQ(ISO_EVT_UTIMER_CHAN), ISO_EVT_UTIMER_CAP_IRQ_PRIO,
+		    capture_irq_handler, &sync_timers[0], 0);
+#endif
 
 	return 0;
 }
@@ -236,6 +195,8 @@ int32_t sync_timer_init(void)
 uint32_t sync_timer_start(void (*sync_timer_capture_evt_cb)(void),
 			  void (*sync_timer_overflow_evt_cb)(void))
 {
+	uint32_t mask = 0;
+
 	if (sync_timer_capture_evt_cb) {
 		sync_timer_cap_cb = sync_timer_capture_evt_cb;
 	}
@@ -246,34 +207,69 @@ uint32_t sync_timer_start(void (*sync_timer_capture_evt_cb)(void),
 	/* Enable IRQs */
 	sync_timer_restore_evts();
 
-	/* Global timer channel enable */
-	((TIMER_RegInfo *)(UTIMER_BASE))->glb_cntr_start |= (1 << ISO_EVT_UTIMER_CHAN);
-
-	/* LOG_DBG("ISO sync timer started"); */
+	/* Global timer channel enable, all instances on the same clock edge */
+	for (size_t i = 0; i < SYNC_TIMER_COUNT; i++) {
+		mask |= (1u << sync_timers[i].utimer_chan);
+	}
+	alif_utimer_start_counters(UTIMER_BASE, mask);
 
 	return CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 }
 
 uint32_t sync_timer_get_curr_cnt(void)
 {
-	return UTIMER_CHAN(ISO_EVT_UTIMER_CHAN)->cntr;
+	return alif_utimer_get_counter_value(sync_timer_chan_base(&sync_timers[0]));
 }
 
 uint32_t sync_timer_get_last_capture(void)
 {
-	return UTIMER_CHAN(ISO_EVT_UTIMER_CHAN)->capture_a;
+	return alif_utimer_get_capture_value(sync_timer_chan_base(&sync_timers[0]), 0);
 }
 
 void sync_timer_disable_evts(void)
 {
-	irq_disable(ISO_EVT_UTIMER_OVF_IRQ);
-	irq_disable(ISO_EVT_UTIMER_CAP_A_IRQ);
-	NVIC_ClearPendingIRQ(ISO_EVT_UTIMER_OVF_IRQ);
-	NVIC_ClearPendingIRQ(ISO_EVT_UTIMER_CAP_A_IRQ);
+	for (size_t i = 0; i < SYNC_TIMER_COUNT; i++) {
+		irq_disable(sync_timers[i].ovf_irq);
+		irq_disable(sync_timers[i].cap_irq);
+		NVIC_ClearPendingIRQ(sync_timers[i].ovf_irq);
+		NVIC_ClearPendingIRQ(sync_timers[i].cap_irq);
+	}
 }
 
 void sync_timer_restore_evts(void)
 {
-	irq_enable(ISO_EVT_UTIMER_OVF_IRQ);
-	irq_enable(ISO_EVT_UTIMER_CAP_A_IRQ);
+	for (size_t i = 0; i < SYNC_TIMER_COUNT; i++) {
+		irq_enable(sync_timers[i].ovf_irq);
+		irq_enable(sync_timers[i].cap_irq);
+	}
+}
+
+int32_t sync_timer_drift_start(uint8_t idx, uint32_t nominal_period)
+{
+	unsigned int key;
+
+	if (idx >= SYNC_TIMER_COUNT) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	sync_drift_init(&sync_timers[idx].drift, nominal_period);
+	irq_unlock(key);
+
+	return 0;
+}
+
+int32_t sync_timer_drift_get(uint8_t idx, struct sync_drift_result *result)
+{
+	unsigned int key;
+
+	if (idx >= SYNC_TIMER_COUNT || result == NULL) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	sync_drift_get(&sync_timers[idx].drift, result);
+	irq_unlock(key);
+
+	return 0;
 }
@@ -8,6 +8,7 @@
 #define _SYNC_TIMER_H
 
 #include <stdint.h>
+#include "sync_drift.h"
 
 /**
  * @file sync_timer.h
@@ -66,4 +67,27 @@ void sync_timer_disable_evts(void);
  */
 void sync_timer_restore_evts(void);
 
+/**
+ * @brief  Start drift tracking of the capture events of a sync timer instance
+ *
+ *         Instance 0 is the sync timer used by the BLE host stack. Call again with the new
+ *         period whenever the event interval changes, 0 stops tracking.
+ *
+ * @param idx             Sync timer instance
+ * @param nominal_period  Nominal capture event period, e.g. the ISO interval, in timer ticks
+ *
+ * @return 0 on success, -EINVAL for an unknown instance
+ */
+int32_t sync_timer_drift_start(uint8_t idx, uint32_t nominal_period);
+
+/**
+ * @brief  Gets the drift of the capture events against the timer clock
+ *
+ * @param idx     Sync timer instance
+ * @param result  Drift in ppb, filtered capture offset in ticks, tracked period and lock state
+ *
+ * @return 0 on success, -EINVAL for an unknown instance
+ */
+int32_t sync_timer_drift_get(uint8_t idx, struct sync_drift_result *result);
+
 #endif /* _SYNC_TIMER_H */
@@ -0,0 +1,101 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef EVTRTR_H_
+#define EVTRTR_H_
+
+#include <stdint.h>
+
+/*
+ * Event router.
+ *
+ * Channel n of a router carries one of four peripheral events, picked by
+ * its group select. The selected event becomes DMA request n of the DMA
+ * controller behind the router (when DMA is enabled on the channel) and
+ * global event n, which the UTIMER trigger source registers see as
+ * trigger n (CNTR_SRC0_TRIG_RISING(n) / CNTR_SRC0_TRIG_FALLING(n)).
+ *
+ * Which event sits in which group of which channel is fixed by the SoC,
+ * so a channel is claimed for a specific group. A second claim of the
+ * same channel with the same routing is shared and reference counted,
+ * a claim with different routing fails with -EBUSY. The router clock is
+ * enabled with the first claim. It is left on after the last release,
+ * the same clock gate also feeds the DMA controller.
+ */
+
+#define EVTRTR_CHANNELS				32U
+#define EVTRTR_GROUPS				4U
+
+struct evtrtr_regs {
+	volatile uint32_t  DMA_CTRL[EVTRTR_CHANNELS];  /* 0x00 Channel Select  */
+	volatile uint32_t  DMA_REQ_CTRL;               /* 0x80 Request Ctrl    */
+	volatile uint32_t  DMA_ACK_TYPE;               /* 0x84 Ack Type        */
+};
+
+#define EVTRTR_DMA_CTRL_SEL_Msk			(0x3U)
+#define EVTRTR_DMA_CTRL_ENA			(1U << 4)
+
+/* DMA2 / event router 2, local to the M55-HE */
+#define EVTRTR2_BASE				0x400E2000U
+#define EVTRTR2_CLK_REG				0x43007010U
+#define EVTRTR2_CLK_EN				(1U << 4)
+
+/* alif_evtrtr_connect() flags */
+#define EVTRTR_ROUTE_DMA			(1U << 0)  /* drive DMA request n */
+#define EVTRTR_ROUTE_ACK_ROUTER			(1U << 1)  /* router acks DMA */
+
+enum evtrtr_instance {
+	EVTRTR_2,
+	EVTRTR_INSTANCES,
+};
+
+/**
+ * \fn        int32_t alif_evtrtr_set_regs(enum evtrtr_instance inst,
+ *                   struct evtrtr_regs *regs, volatile uint32_t *clk_reg)
+ * \brief     move a router to other register blocks, e.g. memory for a
+ *            host test. The SoC addresses are used until this is called.
+ * \param[in] inst     router
+ * \param[in] regs     router registers
+ * \param[in] clk_reg  clock gate register, EVTRTR<n>_CLK_EN is set in it
+ * \return    0 on success, -EINVAL on bad parameters, -EBUSY while
+ *            channels are claimed
+ */
+int32_t alif_evtrtr_set_regs(enum evtrtr_instance inst,
+			struct evtrtr_regs *regs, volatile uint32_t *clk_reg);
+
+/**
+ * \fn        int32_t alif_evtrtr_connect(enum evtrtr_instance inst,
+ *                   uint8_t chan, uint8_t group, uint32_t flags)
+ * \brief     claim a channel and route event group of it to global
+ *            event chan, and to DMA request chan with EVTRTR_ROUTE_DMA.
+ * \param[in] inst   router
+ * \param[in] chan   channel, 0 .. EVTRTR_CHANNELS - 1
+ * \param[in] group  event group select, 0 .. EVTRTR_GROUPS - 1
+ * \param[in] flags  EVTRTR_ROUTE_*
+ * \return    0 on success, -EINVAL on bad parameters, -EBUSY when the
+ *            channel is claimed with a different routing
+ */
+int32_t alif_evtrtr_connect(enum evtrtr_instance inst, uint8_t chan,
+			uint8_t group, uint32_t flags);
+
+/**
+ * \fn        int32_t alif_evtrtr_release(enum evtrtr_instance inst,
+ *                   uint8_t chan)
+ * \brief     drop a claim. The last one disables the channel.
+ * \param[in] inst  router
+ * \param[in] chan  channel
+ * \return    0 on success, -EINVAL if the channel is not claimed
+ */
+int32_t alif_evtrtr_release(enum evtrtr_instance inst, uint8_t chan);
+
+/**
+ * \fn        uint32_t alif_evtrtr_claimed(enum evtrtr_instance inst)
+ * \brief     channels currently claimed.
+ * \param[in] inst  router
+ * \return    bit n set when channel n is claimed
+ */
+uint32_t alif_evtrtr_claimed(enum evtrtr_instance inst);
+
+#endif /* EVTRTR_H_ */
@@ -0,0 +1,148 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <cmsis_core.h>
+#include <evtrtr.h>
+
+struct evtrtr_inst {
+	struct evtrtr_regs *regs;
+	volatile uint32_t *clk_reg;
+	uint32_t clk_en;
+	uint32_t claimed;                       /* bit per claimed channel */
+	uint8_t ctrl[EVTRTR_CHANNELS];          /* dma_ctrl of the claim */
+	uint8_t ack[EVTRTR_CHANNELS];           /* ack type of the claim */
+	uint8_t refs[EVTRTR_CHANNELS];
+};
+
+static struct evtrtr_inst g_evtrtr[EVTRTR_INSTANCES] = {
+	[EVTRTR_2] = {
+		.regs = (struct evtrtr_regs *)(uintptr_t)EVTRTR2_BASE,
+		.clk_reg = (volatile uint32_t *)(uintptr_t)EVTRTR2_CLK_REG,
+		.clk_en = EVTRTR2_CLK_EN,
+	},
+};
+
+int32_t alif_evtrtr_set_regs(enum evtrtr_instance inst,
+			struct evtrtr_regs *regs, volatile uint32_t *clk_reg)
+{
+	struct evtrtr_inst *rtr;
+	uint32_t primask;
+	int32_t ret = 0;
+
+	if (inst >= EVTRTR_INSTANCES || regs == NULL || clk_reg == NULL) {
+		return -EINVAL;
+	}
+
+	rtr = &g_evtrtr[inst];
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (rtr->claimed != 0) {
+		ret = -EBUSY;
+	} else {
+		rtr->regs = regs;
+		rtr->clk_reg = clk_reg;
+	}
+
+	__set_PRIMASK(primask);
+
+	return ret;
+}
+
+int32_t alif_evtrtr_connect(enum evtrtr_instance inst, uint8_t chan,
+			uint8_t group, uint32_t flags)
+{
+	struct evtrtr_inst *rtr;
+	uint32_t primask, ctrl, ack;
+	int32_t ret = 0;
+
+	if (inst >= EVTRTR_INSTANCES || chan >= EVTRTR_CHANNELS ||
+	    group >= EVTRTR_GROUPS) {
+		return -EINVAL;
+	}
+
+	rtr = &g_evtrtr[inst];
+	ctrl = group;
+	if (flags & EVTRTR_ROUTE_DMA) {
+		ctrl |= EVTRTR_DMA_CTRL_ENA;
+	}
+	ack = (flags & EVTRTR_ROUTE_ACK_ROUTER) ? 1U : 0U;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (rtr->claimed & (1U << chan)) {
+		if (rtr->ctrl[chan] != ctrl || rtr->ack[chan] != ack ||
+		    rtr->refs[chan] == UINT8_MAX) {
+			ret = -EBUSY;
+		} else {
+			rtr->refs[chan]++;
+		}
+		goto out;
+	}
+
+	if (rtr->claimed == 0) {
+		*rtr->clk_reg |= rtr->clk_en;
+	}
+
+	rtr->claimed |= (1U << chan);
+	rtr->ctrl[chan] = (uint8_t)ctrl;
+	rtr->ack[chan] = (uint8_t)ack;
+	rtr->refs[chan] = 1;
+
+	if (ack) {
+		rtr->regs->DMA_ACK_TYPE |= (1U << chan);
+	} else {
+		rtr->regs->DMA_ACK_TYPE &= ~(1U << chan);
+	}
+	rtr->regs->DMA_CTRL[chan] = ctrl;
+
+out:
+	__set_PRIMASK(primask);
+
+	return ret;
+}
+
+int32_t alif_evtrtr_release(enum evtrtr_instance inst, uint8_t chan)
+{
+	struct evtrtr_inst *rtr;
+	uint32_t primask;
+	int32_t ret = 0;
+
+	if (inst >= EVTRTR_INSTANCES || chan >= EVTRTR_CHANNELS) {
+		return -EINVAL;
+	}
+
+	rtr = &g_evtrtr[inst];
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	if ((rtr->claimed & (1U << chan)) == 0) {
+		ret = -EINVAL;
+	} else if (--rtr->refs[chan] == 0) {
+		rtr->regs->DMA_CTRL[chan] = 0;
+		rtr->regs->DMA_ACK_TYPE &= ~(1U << chan);
+		rtr->claimed &= ~(1U << chan);
+	}
+
+	__set_PRIMASK(primask);
+
+	return ret;
+}
+
+uint32_t alif_evtrtr_claimed(enum evtrtr_instance inst)
+{
+	if (inst >= EVTRTR_INSTANCES) {
+		return 0;
+	}
+
+	return g_evtrtr[inst].claimed;
+}
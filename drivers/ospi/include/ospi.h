@@ -270,6 +270,9 @@ struct ospi_aes_regs {
 #define SPI_CTRLR0_INST_L_8bit                  0x2U
 #define SPI_CTRLR0_INST_L_16bit                 0x3U
 
+/* Number of Data Frames NDF bit[15:0] in CTRLR1 */
+#define SPI_CTRLR1_NDF_MAX                      0x10000U
+
 #define SPI_DMACR_TDMAE                         2U
 #define SPI_DMACR_RDMAE                         1U
 
@@ -292,6 +295,15 @@ struct ospi_aes_regs {
 #define XIP_CTRL_TRANS_TYPE_OFFSET              2U
 #define XIP_CTRL_FRF_OFFSET                     0U
 
+/* XIP_MBL : Burst length of a continuous XiP fetch */
+#define XIP_CTRL_XIP_MBL_2                      0U
+#define XIP_CTRL_XIP_MBL_4                      1U
+#define XIP_CTRL_XIP_MBL_8                      2U
+#define XIP_CTRL_XIP_MBL_16                     3U
+
+/* Default XIP_CNT_TIME_OUT in ssi_clk cycles */
+#define OSPI_XIP_CNT_TIME_OUT_DEFAULT           100U
+
 #define XIP_WRITE_CTRL_XIPWR_DFS_HC_OFFSET      21U
 #define XIP_WRITE_CTRL_XIPWR_WAIT_CYCLES        16U
 #define XIP_WRITE_CTRL_XIPWR_DM_EN_OFFSET       14U
@@ -402,6 +414,12 @@ enum spi_transfer_status {
  * struct ospi_transfer.
  * Information about an ongoing OSPI transfer.
  */
+struct ospi_transfer;
+
+/* FIFO fill/drain kernel, selected once per transfer */
+typedef void (*ospi_fifo_fn)(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer, uint32_t count);
+
 struct ospi_transfer {
 	uint32_t            tx_current_cnt;     /* Current Tx Transfer count */
 	uint32_t            rx_current_cnt;     /* Current Rx Transfer count */
@@ -416,9 +434,12 @@ struct ospi_transfer {
 	uint32_t            dummy_cycle;        /* Dummy cycles    */
 	uint32_t            ddr;                /* DDR / SDR mode  */
 	uint32_t            ddr_inst_en;        /* Instruction in DDR Mode */
+	uint32_t            dfs;                /* Frame size, 0: keep CTRLR0 */
 	bool                tx_default_enable;  /* Enable Tx default */
 	enum spi_tmode      mode;               /* SPI transfer mode */
 	enum spi_transfer_status    status;    /* transfer status */
+	ospi_fifo_fn        tx_fill;            /* Tx FIFO fill kernel */
+	ospi_fifo_fn        rx_drain;           /* Rx FIFO drain kernel */
 
 	/**XiP Configuration*/
 	uint16_t            wrap_cmd;           /* WRAP OpCode */
@@ -441,6 +462,56 @@ struct ospi_xip_config {
 	uint16_t                xip_cnt_time_out;    /* Timeout value */
 	uint16_t                xip_wait_cycles;     /* Dummy cycles*/
 	uint16_t                xip_rxds_vl_en;      /* Enable RxDS_VL_EN bit */
+	uint16_t                xip_prefetch_en;     /* XiP Prefetch */
+	uint16_t                xip_cont_xfer_en;    /* Continuous Transfer */
+	uint16_t                xip_mbl;             /* XIP_CTRL_XIP_MBL_x */
+};
+
+#define OSPI_CONTEXT_MAGIC   0x4F435458U        /* "OCTX" */
+
+#if defined(CONFIG_ENSEMBLE_GEN2)
+/* AES_RXD_DELAY_0 (0x40) .. AES_SCLK_DELAY (0x78) */
+#define OSPI_CONTEXT_AES_DELAY_REGS  15
+#endif
+
+/**
+ * struct ospi_context.
+ * Snapshot of the OSPI and AES configuration registers, kept in
+ * retention memory across low-power states and written back in one
+ * pass by ospi_restore_context().
+ */
+struct ospi_context {
+	uint32_t                magic;               /* OSPI_CONTEXT_MAGIC */
+	uint32_t                ctrlr0;
+	uint32_t                ctrlr1;
+	uint32_t                enr;
+	uint32_t                ser;
+	uint32_t                baudr;
+	uint32_t                txftlr;
+	uint32_t                rxftlr;
+	uint32_t                imr;
+	uint32_t                dmacr;
+	uint32_t                dmatdlr;
+	uint32_t                dmardlr;
+	uint32_t                rx_sample_delay;
+	uint32_t                spi_ctrlr0;
+	uint32_t                ddr_drive_edge;
+	uint32_t                xip_mode_bits;
+	uint32_t                xip_incr_inst;
+	uint32_t                xip_wrap_inst;
+	uint32_t                xip_ctrl;
+	uint32_t                xip_ser;
+	uint32_t                xip_cnt_time_out;
+	uint32_t                xip_write_incr_inst;
+	uint32_t                xip_write_wrap_inst;
+	uint32_t                xip_write_ctrl;
+	uint32_t                aes_ctrl;
+	uint32_t                aes_intr_mask;
+	uint32_t                aes_addr_control;
+	uint32_t                aes_rxds_dly;
+#if defined(CONFIG_ENSEMBLE_GEN2)
+	uint32_t                aes_delay[OSPI_CONTEXT_AES_DELAY_REGS];
+#endif
 };
 
 /**
@@ -1018,6 +1089,29 @@ void ospi_hyperbus_xip_init(struct ospi_regs *ospi, uint8_t wait_cycles, bool is
 */
 void ospi_hyperbus_send(struct ospi_regs *ospi, struct ospi_transfer *transfer);
 
+/**
+  \fn          void ospi_hyperbus_send_async(struct ospi_regs *ospi,
+						struct ospi_transfer *transfer)
+  \brief       Prepare the OSPI Hyperbus for an interrupt driven
+		transmission, completed through ospi_irq_handler
+  \param[in]   ospi       Pointer to the OSPI register map
+  \param[in]   transfer   Transfer parameters
+  \return      none
+*/
+void ospi_hyperbus_send_async(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer);
+
+/**
+  \fn          void ospi_hyperbus_dma_send(struct ospi_regs *ospi,
+						struct ospi_transfer *transfer)
+  \brief       Prepare the OSPI Hyperbus for transmission with DMA support
+  \param[in]   ospi       Pointer to the OSPI register map
+  \param[in]   transfer   Transfer parameters
+  \return      none
+*/
+void ospi_hyperbus_dma_send(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer);
+
 /**
  * \fn          void ospi_irq_handler(struct ospi_regs *ospi,
  *                                    struct ospi_transfer *transfer)
@@ -1069,6 +1163,33 @@ void ospi_xip_disable(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
 void ospi_psram_xip_init(struct ospi_regs *ospi,
 		struct ospi_xip_config *xip_cfg, bool is_dual_octal);
 
+/**
+ * \fn          void ospi_save_context(struct ospi_regs *ospi,
+ *                    struct ospi_aes_regs *aes, struct ospi_context *ctx)
+ * \brief       Snapshot the OSPI and AES configuration registers
+ * \param[in]   ospi Pointer to the OSPI register map
+ * \param[in]   aes  Pointer to the AES register map
+ * \param[out]  ctx  Snapshot, should live in retention memory
+ * \return      none
+ */
+void ospi_save_context(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
+		struct ospi_context *ctx);
+
+/**
+ * \fn          void ospi_restore_context(struct ospi_regs *ospi,
+ *                    struct ospi_aes_regs *aes,
+ *                    const struct ospi_context *ctx)
+ * \brief       Write a snapshot back with the controller disabled, then
+ *              re-enable it and XiP as they were when it was taken. Uses
+ *              no HAL state, so it can run first thing after wake-up.
+ * \param[in]   ospi Pointer to the OSPI register map
+ * \param[in]   aes  Pointer to the AES register map
+ * \param[in]   ctx  Snapshot from ospi_save_context()
+ * \return      none
+ */
+void ospi_restore_context(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
+		const struct ospi_context *ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __OSPI_CALIB_H__
+#define __OSPI_CALIB_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ospi_hal.h"
+
+/*
+ * Rx sample delay / Rx-DS delay calibration.
+ *
+ * The sweep sets every delay pair of a window, asks the caller's probe
+ * to read back a known pattern and records pass/fail in a map. The
+ * chosen pair is the passing point with the largest L-infinity
+ * distance to a failing point, i.e. the center of the largest passing
+ * square. The sweep border counts as failing on a swept axis; a window
+ * with a single step on one axis is a 1-D sweep along the other one.
+ * Of several points with the same margin, the one nearest their
+ * centroid wins, so an elongated window resolves to its middle. The
+ * result can be stored by the caller and checked with
+ * ospi_calib_result_valid() at the next boot.
+ */
+
+#define OSPI_CALIB_MAGIC                0x4F43414CU     /* "OCAL" */
+
+/* Pattern read back: 0 when it matches, else error code */
+typedef int32_t (*ospi_calib_probe_fn)(HAL_OSPI_Handle_T handle, void *ctx);
+
+/*---- Sweep window ----*/
+struct ospi_calib_config {
+	uint8_t   smpl_min;             /* First Rx sample delay */
+	uint8_t   smpl_max;             /* Last Rx sample delay */
+	uint8_t   ds_min;               /* First Rx-DS delay */
+	uint8_t   ds_max;               /* Last Rx-DS delay */
+	uint32_t  bus_speed;            /* Bus speed it is run at */
+	ospi_calib_probe_fn probe;      /* Pattern check */
+	void      *ctx;                 /* Context for probe */
+};
+
+/*---- Persistable result ----*/
+struct ospi_calib_result {
+	uint32_t  magic;                /* OSPI_CALIB_MAGIC */
+	uint32_t  bus_speed;            /* Bus speed it is valid for */
+	uint8_t   rx_sample_delay;      /* Chosen Rx sample delay */
+	uint8_t   rx_ds_delay;          /* Chosen Rx-DS delay */
+	uint8_t   margin;               /* Passing steps on every side */
+	uint8_t   reserved;
+	uint32_t  checksum;             /* Over the fields above */
+};
+
+/**
+ * \fn          ospi_calib_find_center
+ * \brief       Pick the passing point with the largest margin,
+ *              ties broken toward the centroid of the tied points.
+ * \param[in]   pass_map  Pass flags, pass_map[ds * n_smpl + smpl]
+ * \param[in]   n_smpl  Number of Rx sample delay steps
+ * \param[in]   n_ds  Number of Rx-DS delay steps
+ * \param[out]  smpl  Chosen Rx sample delay step
+ * \param[out]  ds  Chosen Rx-DS delay step
+ * \return      margin (>= 0) on Success, else error code.
+ */
+int32_t ospi_calib_find_center(const uint8_t *pass_map, uint32_t n_smpl,
+			uint32_t n_ds, uint32_t *smpl, uint32_t *ds);
+
+/**
+ * \fn          ospi_calib_run
+ * \brief       Sweep both delays, apply the center of the passing
+ *              window and fill the result. On failure the previous
+ *              delays are not restored.
+ * \param[in]   handle  Instance handler
+ * \param[in]   cfg  Sweep window and probe
+ * \param[out]  pass_map  Scratch, (smpl span) * (ds span) bytes
+ * \param[out]  res  Result, sealed
+ * \return      0 on Success, else error code.
+ */
+int32_t ospi_calib_run(HAL_OSPI_Handle_T handle,
+			const struct ospi_calib_config *cfg,
+			uint8_t *pass_map, struct ospi_calib_result *res);
+
+/**
+ * \fn          ospi_calib_result_seal
+ * \brief       Set the magic and checksum of a result before storing it.
+ * \param[in]   res  Result
+ * \return      none
+ */
+void ospi_calib_result_seal(struct ospi_calib_result *res);
+
+/**
+ * \fn          ospi_calib_result_valid
+ * \brief       Check a stored result against the current bus speed.
+ * \param[in]   res  Result
+ * \param[in]   bus_speed  Bus speed about to be used
+ * \return      true when the result can be applied.
+ */
+bool ospi_calib_result_valid(const struct ospi_calib_result *res,
+			uint32_t bus_speed);
+
+#endif /* __OSPI_CALIB_H__ */
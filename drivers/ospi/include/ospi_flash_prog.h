@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __OSPI_FLASH_PROG_H__
+#define __OSPI_FLASH_PROG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ospi_hal.h"
+
+/*
+ * Interrupt driven flash page program engine.
+ *
+ * Each page goes out as one descriptor chain (write enable, page
+ * program, read status) on the instance's descriptor queue. The status
+ * is re-read until the WIP bits clear, so no thread polls the flash.
+ * Status reads are paced by a one-shot timer of the caller: the first
+ * one poll_delay_us after the program, typically the page program time,
+ * then one every poll_interval_us. Back to back reads would keep the
+ * OSPI interrupt busy for the whole program time. While a page
+ * programs, the next one is packed into the second staging buffer, so
+ * the next chain starts right when the flash is ready.
+ *
+ * Use ospi_flash_prog_event as the instance event callback with the
+ * engine as user data, or call it from the application's callback.
+ * Call ospi_flash_prog_timer_expired when the timer started through
+ * start_timer fires.
+ * Data bytes are packed into frames of prog_conf->frame_size bits,
+ * first byte in the most significant position.
+ */
+
+/*---- Engine setup ----*/
+struct ospi_flash_prog_cfg {
+	HAL_OSPI_Handle_T handle;               /* OSPI instance */
+	const struct ospi_trans_config *cmd_conf;       /* Write enable */
+	const struct ospi_trans_config *prog_conf;      /* Page program */
+	const struct ospi_trans_config *status_conf;    /* Read status */
+	uint32_t  cmd_wren;                     /* Write enable opcode */
+	uint32_t  cmd_prog;                     /* Page program opcode */
+	uint32_t  cmd_rdsr;                     /* Read status opcode */
+	uint32_t  rdsr_addr;                    /* Read status address */
+	uint32_t  wip_mask;                     /* Busy bits in the status */
+	uint32_t  page_size;                    /* Bytes, power of 2 */
+	uint32_t  *stage[2];                    /* 2 + page frames each */
+	uint32_t  poll_delay_us;                /* Program to first poll */
+	uint32_t  poll_interval_us;             /* Between status reads */
+
+	/* Start a one-shot timer : 0 on Success, else error code */
+	int32_t   (*start_timer)(uint32_t us, void *ctx);
+
+	/* Job end, called from the IRQ : 0 on Success, else error code */
+	void      (*done_cb)(int32_t status, void *ctx);
+	void      *ctx;                         /* Context for done_cb */
+};
+
+/*---- Engine object ----*/
+struct ospi_flash_prog {
+	struct ospi_flash_prog_cfg cfg;
+	struct ospi_xfer_desc desc[3];          /* Page chain */
+	uint32_t  wren_frame;                   /* Write enable frame */
+	uint32_t  status;                       /* Last status read */
+
+	const uint8_t *src;                     /* Next page data */
+	uint32_t  addr;                         /* Next page address */
+	uint32_t  left;                         /* Bytes not yet packed */
+	uint32_t  next_frames;                  /* Packed next page, 0: none */
+	uint8_t   cur_stage;                    /* Staging buffer on the bus */
+	volatile uint8_t state;                 /* Engine state */
+
+	uint32_t  pages;                        /* Pages programmed */
+	uint32_t  polls;                        /* Status reads issued */
+	uint32_t  timer_errors;                 /* start_timer failures */
+};
+
+/**
+ * \fn          ospi_flash_prog_init
+ * \brief       Set up the program engine.
+ * \param[in]   eng  Engine object
+ * \param[in]   cfg  Commands, configurations and staging buffers
+ * \return      0 on Success, else error code.
+ */
+int32_t ospi_flash_prog_init(struct ospi_flash_prog *eng,
+			const struct ospi_flash_prog_cfg *cfg);
+
+/**
+ * \fn          ospi_flash_prog_start
+ * \brief       Program a range, page by page, in the background. The
+ *              data has to stay valid until done_cb.
+ * \param[in]   eng  Engine object
+ * \param[in]   addr  Flash address, frame aligned
+ * \param[in]   data  Data to program
+ * \param[in]   len  Number of bytes, frame aligned
+ * \return      0 on Success, else error code.
+ */
+int32_t ospi_flash_prog_start(struct ospi_flash_prog *eng, uint32_t addr,
+			const void *data, uint32_t len);
+
+/**
+ * \fn          ospi_flash_prog_busy
+ * \brief       Check whether a job is running.
+ * \param[in]   eng  Engine object
+ * \return      true while programming.
+ */
+bool ospi_flash_prog_busy(const struct ospi_flash_prog *eng);
+
+/**
+ * \fn          ospi_flash_prog_timer_expired
+ * \brief       Timer handler of the engine, issues the next status read.
+ * \param[in]   eng  Engine object
+ * \return      none
+ */
+void ospi_flash_prog_timer_expired(struct ospi_flash_prog *eng);
+
+/**
+ * \fn          ospi_flash_prog_event
+ * \brief       OSPI event handler of the engine.
+ * \param[in]   event  OSPI_EVENT_x
+ * \param[in]   u_data  Engine object
+ * \return      none
+ */
+void ospi_flash_prog_event(uint32_t event, void *u_data);
+
+#endif /* __OSPI_FLASH_PROG_H__ */
@@ -38,6 +38,7 @@
 #define OSPI_EVENT_TRANSFER_COMPLETE (1UL << 0)     /* Transfer completed */
 #define OSPI_EVENT_DATA_LOST         (1UL << 1)     /* Rx o-flow / Tx u-flow */
 #define OSPI_EVENT_MODE_FAULT        (1UL << 2)     /* Master Mode Fault */
+#define OSPI_EVENT_DESC_COMPLETE     (1UL << 3)     /* Queued desc. done */
 
 /*---- OSPI Event ---------------------*/
 #define OSPI_ERR_NONE               0               /* Success */
@@ -45,6 +46,7 @@
 #define OSPI_ERR_INVALID_STATE      -101            /* State Invalid */
 #define OSPI_ERR_CTRL_BUSY          -102            /* Controller Busy */
 #define OSPI_ERR_INVALID_HANDLE     -103            /* Handler not valid */
+#define OSPI_ERR_QUEUE_FULL         -104            /* Descriptor Queue full */
 
 
 /*---- OSPI DFS BITS ------------------*/
@@ -94,13 +96,17 @@ struct ospi_init {
 	uint32_t  core_clk;                     /* System Clock */
 	uint32_t  cs_pin;                       /* Slave Pin */
 	uint32_t  rx_ds_delay;                  /* Rx-DS Delay */
+	uint32_t  tx_dma_level;                 /* Tx DMA request level */
+	uint32_t  rx_dma_level;                 /* Rx DMA request level */
 	enum ospi_baud2_delay baud2_delay;      /* BAUD2 delay initial setting */
 
-	uint32_t  *base_regs;                   /* OSPI REG */
-	uint32_t  *aes_regs;                    /* AES REG */
+	uint32_t  *base_regs;                   /* OSPI REG, selects the */
+						/* DT instance, may be NULL */
+	uint32_t  *aes_regs;                    /* AES REG, unused with DT */
 
 	void      *user_data;                   /* User data*/
 	hal_event_notify_cb *event_cb;          /* Event Callback*/
+	uint32_t  (*get_cycles)(void);          /* Stats time source, opt.*/
 
 	uint16_t  xip_wrap_cmd;			/* WRAP OpCode*/
 	uint16_t  xip_incr_cmd;			/* INCR mode OpCode*/
@@ -108,6 +114,9 @@ struct ospi_init {
 	uint16_t  xip_aes_rxds_dly;		/* AES RxDS Delay*/
 	uint16_t  xip_wait_cycles;		/* XiP Wait Cycle*/
 	uint16_t  xip_rxds_vl_en;		/* XiP RxDS variable latency*/
+	uint16_t  xip_prefetch_en;		/* XiP Prefetch enable*/
+	uint16_t  xip_cont_xfer_en;		/* XiP Continuous Transfer*/
+	uint16_t  xip_mbl;			/* XiP Burst Length*/
 };
 
 /*---- OSPI Event ---------------------*/
@@ -123,10 +132,83 @@ struct ospi_trans_config {
 	uint8_t  ddr_ins_enable;        /* Enable Instruction in DDR mode*/
 };
 
+/*---- OSPI Transfer Descriptor -------*/
+enum ospi_desc_type {
+	OSPI_DESC_SEND,                 /* as alif_hal_ospi_send */
+	OSPI_DESC_TRANSFER,             /* as alif_hal_ospi_transfer */
+	OSPI_DESC_RECEIVE,              /* as alif_hal_ospi_receive */
+};
+
+/*
+ * Send and Transfer descriptors carry the command and address frames
+ * at the head of data_out, as the direct calls do. Receive descriptors
+ * use cmd and addr.
+ */
+struct ospi_xfer_desc {
+	enum ospi_desc_type type;       /* Transfer type */
+	const struct ospi_trans_config *trans_conf; /* NULL: keep current */
+	uint32_t  cmd;                  /* Receive: Command frame */
+	uint32_t  addr;                 /* Receive: Start address */
+	void      *data_out;            /* Send/Transfer: Transmit frames */
+	void      *data_in;             /* Transfer/Receive: Receive buffer */
+	int       num;                  /* Number of frames */
+	uint8_t   notify;               /* Report OSPI_EVENT_DESC_COMPLETE */
+};
+
+/*---- OSPI Statistics ----------------*/
+#define OSPI_STATS_HIST_BINS         24             /* Latency bins */
+
+/*
+ * Bytes are FIFO frames times the frame size, for every transfer type:
+ * the command and address frames are counted along with the data. A
+ * Send carries them in its own buffer, Transfer and Receive add them.
+ * Latency bin n counts transfers of [2^(n-1), 2^n) cycles, the last bin
+ * everything above. Latencies are only taken with a get_cycles source.
+ */
+struct ospi_stats {
+	uint64_t  bytes;                /* Frame bytes moved, incl. cmd/addr */
+	uint32_t  transfers;            /* Completed transfers */
+	uint32_t  irqs;                 /* OSPI interrupts handled */
+	uint32_t  max_irqs_per_xfer;    /* Most IRQs taken by one transfer */
+	uint32_t  overflows;            /* Rx/Tx FIFO overflow events */
+	uint32_t  underflows;           /* Rx FIFO underflow events */
+	uint32_t  xip_switches;         /* XiP enable/disable switches */
+	uint32_t  lat_samples;          /* Transfers with a latency */
+	uint32_t  lat_min;              /* Shortest transfer, cycles */
+	uint32_t  lat_max;              /* Longest transfer, cycles */
+	uint32_t  lat_hist[OSPI_STATS_HIST_BINS];   /* log2 histogram */
+};
+
+/*---- OSPI XiP Write Burst -----------*/
+struct ospi_write_op {
+	uint32_t    addr;               /* Flash address */
+	const void  *data;              /* Data to program */
+	uint32_t    len;                /* Number of bytes */
+};
+
+/* Program one operation in command mode: 0 on Success, else error code */
+typedef int32_t (*ospi_program_fn)(HAL_OSPI_Handle_T handle,
+				const struct ospi_write_op *op, void *ctx);
+
+struct ospi_write_burst {
+	const struct ospi_write_op *ops;    /* Program operations */
+	uint32_t  num_ops;              /* Number of operations */
+	ospi_program_fn program;        /* Flash specific program sequence */
+	void      *ctx;                 /* Context for program */
+	uint32_t  (*get_cycles)(void);  /* Optional time source */
+
+	uint32_t  done;                 /* Out: operations programmed */
+	uint32_t  xip_off_cycles;       /* Out: time XiP was unavailable */
+};
+
 
 /**
  * \fn          alif_hal_ospi_initialize
- * \brief       Get Instance and Initialized with given parameter
+ * \brief       Get Instance and Initialized with given parameter.
+ *              With CONFIG_ALIF_OSPI_DT_INSTANCES the handle is the index
+ *              n of the devicetree node ospi<n> whose register block is
+ *              init_d->base_regs, and the register addresses come from
+ *              devicetree.
  * \param[out]  handle  Instance handler
  * \param[in]   init_d  Instance's initial values
  * \return      0 on Success, else error code
@@ -178,14 +260,123 @@ int32_t alif_hal_ospi_transfer(HAL_OSPI_Handle_T handle,
 
 /**
  * \fn          alif_hal_ospi_receive
- * \brief       Send and Receive data
+ * \brief       Receive data in Receive only mode. Reads longer than the
+ *              controller's NDF limit are split in chunks, each re-issuing
+ *              the command with the address advanced past the data already
+ *              read. OSPI_EVENT_TRANSFER_COMPLETE is reported once for
+ *              the whole read.
+ *              The earlier alif_hal_ospi_receive(handle, data_out, num)
+ *              was a stub that did nothing; callers move to this form.
+ * \param[in]   handle  Instance handler
+ * \param[in]   cmd  Command (instruction) frame
+ * \param[in]   addr  Start address, not sent for OSPI_ADDR_LENGTH_0_BITS.
+ *                    With OSPI_ADDR_LENGTH_24_BITS it is sent as three
+ *                    byte frames, as for alif_hal_ospi_transfer()
+ * \param[in]   data_in  Receive data buffer
+ * \param[in]   num  Number of frames to receive
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_receive(HAL_OSPI_Handle_T handle, uint32_t cmd,
+				uint32_t addr, void *data_in, int num);
+
+/**
+ * \fn          alif_hal_ospi_dma_send
+ * \brief       Transfer the data, with the Tx FIFO fed by DMA.
+ *              The caller's DMA channel must move num frames from data_out
+ *              to the address given by alif_hal_ospi_get_dma_addr().
+ * \param[in]   handle  Instance handler
+ * \param[in]   data_out  Transmit data buffer
+ * \param[in]   num  length of the buffer
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_dma_send(HAL_OSPI_Handle_T handle,
+			void *data_out, int num);
+
+/**
+ * \fn          alif_hal_ospi_hyperbus_send
+ * \brief       Hyperbus write, interrupt driven. Completion is reported
+ *              through OSPI_EVENT_TRANSFER_COMPLETE.
+ * \param[in]   handle  Instance handler
+ * \param[in]   data  Command/Address frames followed by the data
+ * \param[in]   num  length of the buffer
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_hyperbus_send(HAL_OSPI_Handle_T handle, void *data,
+				int num);
+
+/**
+ * \fn          alif_hal_ospi_hyperbus_dma_send
+ * \brief       Hyperbus write, Tx FIFO fed by DMA. Call
+ *              alif_hal_ospi_dma_complete from the DMA completion, the
+ *              OSPI IRQ then reports OSPI_EVENT_TRANSFER_COMPLETE.
  * \param[in]   handle  Instance handler
- * \param[in]   data_out  Receive data buffer
+ * \param[in]   data  Command/Address frames followed by the data
  * \param[in]   num  length of the buffer
  * \return      0 on Success, else error code.
  */
-int32_t alif_hal_ospi_receive(HAL_OSPI_Handle_T handle,
-				void *data_out, int num);
+int32_t alif_hal_ospi_hyperbus_dma_send(HAL_OSPI_Handle_T handle, void *data,
+				int num);
+
+/**
+ * \fn          alif_hal_ospi_dma_transfer
+ * \brief       Send command/address and Receive data through DMA.
+ *              The caller's DMA channels must move the command frames to,
+ *              and num frames from, the address given by
+ *              alif_hal_ospi_get_dma_addr().
+ * \param[in]   handle  Instance handler
+ * \param[in]   data_out  Transmit data buffer
+ * \param[in]   data_in  Receive data buffer
+ * \param[in]   num  length of the buffer
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_dma_transfer(HAL_OSPI_Handle_T handle,
+			void *data_out, void *data_in, int num);
+
+/**
+ * \fn          alif_hal_ospi_dma_complete
+ * \brief       Finish a DMA send/transfer. Call from the DMA completion
+ *              callback; OSPI_EVENT_TRANSFER_COMPLETE is reported through
+ *              the event callback once the controller is done.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_dma_complete(HAL_OSPI_Handle_T handle);
+
+/**
+ * \fn          alif_hal_ospi_get_dma_addr
+ * \brief       Get the Data(FIFO) register address for DMA.
+ * \param[in]   handle  Instance handler
+ * \param[out]  addr  Data register address
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_get_dma_addr(HAL_OSPI_Handle_T handle,
+			volatile uint32_t **addr);
+
+/**
+ * \fn          alif_hal_ospi_queue_transfer
+ * \brief       Queue a transfer descriptor. It starts right away when the
+ *              queue is idle, else from the IRQ handler as soon as the
+ *              previous descriptor completes. OSPI_EVENT_TRANSFER_COMPLETE
+ *              is reported once the queue drains; an error drops the
+ *              remaining descriptors.
+ * \param[in]   handle  Instance handler
+ * \param[in]   desc  Transfer descriptor, copied into the queue
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_queue_transfer(HAL_OSPI_Handle_T handle,
+				const struct ospi_xfer_desc *desc);
+
+/**
+ * \fn          alif_hal_ospi_queue_chain
+ * \brief       Queue descriptors as one unit, none of them starts before
+ *              all are queued. Fails as a whole when the queue lacks room.
+ * \param[in]   handle  Instance handler
+ * \param[in]   desc  Transfer descriptors, copied into the queue
+ * \param[in]   num  Number of descriptors
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_queue_chain(HAL_OSPI_Handle_T handle,
+				const struct ospi_xfer_desc *desc, uint32_t num);
 
 /**
  * \fn          alif_hal_ospi_irq_handler
@@ -195,6 +386,17 @@ int32_t alif_hal_ospi_receive(HAL_OSPI_Handle_T handle,
  */
 int32_t alif_hal_ospi_irq_handler(HAL_OSPI_Handle_T handle);
 
+/**
+ * \fn          alif_hal_ospi0_irq_handler, alif_hal_ospi1_irq_handler
+ * \brief       Interrupt Handler for the ospi0 / ospi1 devicetree node.
+ *              Same as alif_hal_ospi_irq_handler() for that handle, with
+ *              the instance and register block as constants. Only with
+ *              CONFIG_ALIF_OSPI_DT_INSTANCES and an enabled node.
+ * \return      none
+ */
+void alif_hal_ospi0_irq_handler(void);
+void alif_hal_ospi1_irq_handler(void);
+
 
 /**
  * \fn          alif_hal_ospi_xip_enable
@@ -212,10 +414,96 @@ int32_t alif_hal_ospi_xip_enable(HAL_OSPI_Handle_T handle);
  */
 int32_t alif_hal_ospi_xip_disable(HAL_OSPI_Handle_T handle);
 
+/**
+ * \fn          alif_hal_ospi_xip_suspend
+ * \brief       Suspend XiP for command mode access. Calls nest, only the
+ *              outermost one switches the controller, and
+ *              alif_hal_ospi_xip_enable/disable report busy meanwhile.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_suspend(HAL_OSPI_Handle_T handle);
+
+/**
+ * \fn          alif_hal_ospi_xip_resume
+ * \brief       Resume XiP once the last suspend is released.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_resume(HAL_OSPI_Handle_T handle);
+
+/**
+ * \fn          alif_hal_ospi_xip_write_burst
+ * \brief       Run a batch of program operations under one XiP
+ *              suspend/resume. It stops at the first failing operation,
+ *              XiP is resumed in any case. The caller, program callback
+ *              and data must not live in the XiP region of this instance.
+ * \param[in]   handle  Instance handler
+ * \param[in,out] burst  Operations in, progress and timing out
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_write_burst(HAL_OSPI_Handle_T handle,
+				struct ospi_write_burst *burst);
+/**
+ * \fn          alif_hal_ospi_set_rx_delays
+ * \brief       Update the Rx sample delay and the Rx-DS delay, e.g. with
+ *              a calibration result.
+ * \param[in]   handle  Instance handler
+ * \param[in]   rx_sample_delay  Rx Sample Delay
+ * \param[in]   rx_ds_delay  Rx-DS Delay
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_set_rx_delays(HAL_OSPI_Handle_T handle,
+				uint8_t rx_sample_delay, uint8_t rx_ds_delay);
+
+/**
+ * \fn          alif_hal_ospi_save_context
+ * \brief       Snapshot the controller and AES/XiP registers before a
+ *              low-power state that loses them.
+ * \param[in]   handle  Instance handler
+ * \param[out]  ctx  Snapshot, should live in retention memory
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_save_context(HAL_OSPI_Handle_T handle,
+				struct ospi_context *ctx);
+
+/**
+ * \fn          alif_hal_ospi_restore_context
+ * \brief       Re-apply a snapshot after wake-up instead of running
+ *              alif_hal_ospi_initialize() and alif_hal_ospi_xip_enable()
+ *              again. Code running before the HAL state is usable can
+ *              call ospi_restore_context() directly.
+ * \param[in]   handle  Instance handler
+ * \param[in]   ctx  Snapshot from alif_hal_ospi_save_context()
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_restore_context(HAL_OSPI_Handle_T handle,
+				const struct ospi_context *ctx);
+
+/**
+ * \fn          alif_hal_ospi_get_stats
+ * \brief       Copy the statistics of the instance. Needs
+ *              CONFIG_ALIF_OSPI_STATS.
+ * \param[in]   handle  Instance handler
+ * \param[out]  stats  Statistics
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_get_stats(HAL_OSPI_Handle_T handle,
+				struct ospi_stats *stats);
+
+/**
+ * \fn          alif_hal_ospi_reset_stats
+ * \brief       Clear the statistics of the instance. Needs
+ *              CONFIG_ALIF_OSPI_STATS.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_reset_stats(HAL_OSPI_Handle_T handle);
 
 /**
  * \fn          alif_hal_ospi_deinit
- * \brief       Release the initialized instance.
+ * \brief       Release the initialized instance. A handle that is not
+ *              claimed, or a disabled devicetree node, is rejected.
  * \param[in]   handle  Instance handler
  * \return      0 on Success, else error code.
  */
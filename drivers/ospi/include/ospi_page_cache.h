@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __OSPI_PAGE_CACHE_H__
+#define __OSPI_PAGE_CACHE_H__
+
+#include <stdint.h>
+
+#include "ospi_hal.h"
+
+/*
+ * Read-through LRU page cache for non-XiP flash reads.
+ *
+ * The cache does not access the controller itself, every miss goes
+ * through the backend read callback (usually a wrapper around
+ * alif_hal_ospi_receive()). Page descriptors and page data live in
+ * caller provided storage. The caller serializes access and has to
+ * invalidate the range touched by every program or erase.
+ */
+
+/*---- Backend read: 0 on Success, else error code ----*/
+typedef int32_t (*ospi_cache_read_fn)(void *ctx, uint32_t addr,
+				void *buf, uint32_t len);
+
+/*---- Page descriptor ----*/
+struct ospi_cache_page {
+	uint32_t  addr;                 /* Page aligned flash address */
+	uint32_t  stamp;                /* Last use, for LRU */
+	uint8_t   valid;                /* Page holds flash data */
+};
+
+/*---- Cache object ----*/
+struct ospi_page_cache {
+	struct ospi_cache_page *pages;  /* num_pages descriptors */
+	uint8_t   *data;                /* num_pages * page_size bytes */
+	uint32_t  page_size;            /* Power of 2 */
+	uint32_t  num_pages;            /* Capacity in pages */
+	uint32_t  clock;                /* LRU time */
+
+	ospi_cache_read_fn read;        /* Backend read */
+	void      *ctx;                 /* Backend context */
+
+	uint32_t  hits;                 /* Page lookups served */
+	uint32_t  misses;               /* Page lookups filled */
+};
+
+/**
+ * \fn          ospi_page_cache_init
+ * \brief       Initialize an empty page cache.
+ * \param[in]   cache  Cache object
+ * \param[in]   pages  Page descriptors, num_pages entries
+ * \param[in]   data  Page data, num_pages * page_size bytes
+ * \param[in]   page_size  Page size, power of 2
+ * \param[in]   num_pages  Cache capacity in pages
+ * \param[in]   read  Backend read
+ * \param[in]   ctx  Backend context
+ * \return      0 on Success, else error code.
+ */
+int32_t ospi_page_cache_init(struct ospi_page_cache *cache,
+			struct ospi_cache_page *pages, uint8_t *data,
+			uint32_t page_size, uint32_t num_pages,
+			ospi_cache_read_fn read, void *ctx);
+
+/**
+ * \fn          ospi_page_cache_read
+ * \brief       Read through the cache, missing pages are filled from
+ *              the backend and replace the least recently used page.
+ * \param[in]   cache  Cache object
+ * \param[in]   addr  Flash address
+ * \param[out]  buf  Destination
+ * \param[in]   len  Number of bytes
+ * \return      0 on Success, else error code.
+ */
+int32_t ospi_page_cache_read(struct ospi_page_cache *cache, uint32_t addr,
+			void *buf, uint32_t len);
+
+/**
+ * \fn          ospi_page_cache_invalidate
+ * \brief       Drop the pages overlapping a flash range. Call this for
+ *              every program and erase.
+ * \param[in]   cache  Cache object
+ * \param[in]   addr  Flash address
+ * \param[in]   len  Number of bytes
+ * \return      none
+ */
+void ospi_page_cache_invalidate(struct ospi_page_cache *cache, uint32_t addr,
+			uint32_t len);
+
+/**
+ * \fn          ospi_page_cache_invalidate_all
+ * \brief       Drop all pages.
+ * \param[in]   cache  Cache object
+ * \return      none
+ */
+void ospi_page_cache_invalidate_all(struct ospi_page_cache *cache);
+
+/**
+ * \fn          ospi_page_cache_reset_stats
+ * \brief       Clear the hit/miss counters.
+ * \param[in]   cache  Cache object
+ * \return      none
+ */
+static inline void ospi_page_cache_reset_stats(struct ospi_page_cache *cache)
+{
+	cache->hits = 0;
+	cache->misses = 0;
+}
+
+#endif /* __OSPI_PAGE_CACHE_H__ */
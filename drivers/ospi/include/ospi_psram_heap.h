@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __OSPI_PSRAM_HEAP_H__
+#define __OSPI_PSRAM_HEAP_H__
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+
+#include "ospi_hal.h"
+
+/*
+ * Allocator for memory mapped PSRAM (see ospi_psram_xip_init).
+ *
+ * The region is split into fixed size-class pools, k_mem_slab objects
+ * for frame buffers and tensors of known sizes, followed by a sys_heap
+ * for the rest. Every block starts on a cache line and spans whole
+ * cache lines, so cache maintenance on one block never touches another.
+ * The allocator only works on the given region, it does not access the
+ * controller. Allocation and free are thread and ISR safe, they never
+ * wait.
+ */
+
+#define OSPI_PSRAM_ALIGN                32U     /* D-Cache line size */
+#define OSPI_PSRAM_MAX_POOLS            4U      /* Size classes */
+
+/*---- Size-class pool setup ----*/
+struct ospi_psram_pool_cfg {
+	uint32_t  block_size;           /* Rounded up to OSPI_PSRAM_ALIGN */
+	uint32_t  num_blocks;           /* Blocks in the pool */
+};
+
+/*---- Size-class pool ----*/
+struct ospi_psram_pool {
+	struct k_mem_slab slab;         /* Blocks */
+	uint8_t   *base;                /* First block */
+	uint8_t   *end;                 /* Past the last block */
+	uint32_t  block_size;           /* Block size */
+};
+
+/*---- Heap object ----*/
+struct ospi_psram_heap {
+	struct ospi_psram_pool pools[OSPI_PSRAM_MAX_POOLS];
+	uint32_t  num_pools;            /* Pools in use, ascending sizes */
+
+	struct sys_heap heap;           /* Rest of the region */
+	struct k_spinlock lock;         /* Guards heap */
+	uint32_t  heap_size;            /* Bytes given to the heap */
+
+	atomic_t  alloc_fails;          /* Requests nothing could serve */
+};
+
+/*---- Usage statistics ----*/
+struct ospi_psram_stats {
+	uint32_t  pool_block_size[OSPI_PSRAM_MAX_POOLS];
+	uint32_t  pool_in_use[OSPI_PSRAM_MAX_POOLS];
+	uint32_t  pool_peak[OSPI_PSRAM_MAX_POOLS];
+	uint32_t  pool_free[OSPI_PSRAM_MAX_POOLS];
+	uint32_t  num_pools;            /* Valid pool entries */
+	uint32_t  heap_size;            /* Bytes given to the heap */
+	uint32_t  heap_used;            /* Bytes allocated, no metadata */
+	uint32_t  heap_peak;            /* Most bytes allocated */
+	uint32_t  heap_free;            /* Bytes free, may be fragmented */
+	uint32_t  alloc_fails;          /* Requests nothing could serve */
+};
+
+/**
+ * \fn          ospi_psram_heap_init
+ * \brief       Set up pools and heap on a memory region. Not thread
+ *              safe, call before the heap is shared.
+ * \param[in]   heap  Heap object
+ * \param[in]   base  Region start, e.g. the PSRAM XiP base
+ * \param[in]   size  Region size in bytes
+ * \param[in]   pools  Size-class pools, may be NULL
+ * \param[in]   num_pools  Number of pools
+ * \return      0 on Success, else error code.
+ */
+int32_t ospi_psram_heap_init(struct ospi_psram_heap *heap, void *base,
+			uint32_t size, const struct ospi_psram_pool_cfg *pools,
+			uint32_t num_pools);
+
+/**
+ * \fn          ospi_psram_alloc
+ * \brief       Allocate a cache line aligned block. The smallest pool
+ *              with a free block that fits is used, else the heap.
+ * \param[in]   heap  Heap object
+ * \param[in]   size  Number of bytes
+ * \return      Block, NULL when nothing fits.
+ */
+void *ospi_psram_alloc(struct ospi_psram_heap *heap, uint32_t size);
+
+/**
+ * \fn          ospi_psram_free
+ * \brief       Release a block from ospi_psram_alloc.
+ * \param[in]   heap  Heap object
+ * \param[in]   ptr  Block, NULL is ignored
+ * \return      none
+ */
+void ospi_psram_free(struct ospi_psram_heap *heap, void *ptr);
+
+/**
+ * \fn          ospi_psram_get_stats
+ * \brief       Collect the usage statistics. pool_peak needs
+ *              CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION and the heap_used,
+ *              heap_peak and heap_free figures need
+ *              CONFIG_SYS_HEAP_RUNTIME_STATS, else they read as 0.
+ * \param[in]   heap  Heap object
+ * \param[out]  stats  Statistics
+ * \return      none
+ */
+void ospi_psram_get_stats(struct ospi_psram_heap *heap,
+			struct ospi_psram_stats *stats);
+
+#endif /* __OSPI_PSRAM_HEAP_H__ */
@@ -14,18 +14,34 @@
 			| SPI_IMR_RX_FIFO_FULL_INTERRUPT_MASK		   \
 			| SPI_IMR_MULTI_MASTER_CONTENTION_INTERRUPT_MASK)  \
 
-/* Helper : update CTRL0 Reg with Frame Format and Transer mode bits */
+/*
+ * Helper : update CTRL0 Reg with Frame Format, Transer mode and, when
+ * the transfer carries one, the Data Frame Size bits
+ */
 static uint32_t update_ctrl0_frf_tmode(uint32_t reg_val,
-					uint32_t frf,
+					struct ospi_transfer *transfer,
 					uint32_t t_mode)
 {
 	reg_val &= ~(SPI_CTRLR0_SPI_FRF_MASK
 			| (SPI_CTRLR0_TMOD_MASK | SPI_CTRLR0_SSTE_MASK));
-	reg_val |= ((frf << SPI_CTRLR0_SPI_FRF) | t_mode);
+	reg_val |= ((transfer->spi_frf << SPI_CTRLR0_SPI_FRF) | t_mode);
+
+	if (transfer->dfs != 0) {
+		reg_val &= ~SPI_CTRLR0_DFS_MASK;
+		reg_val |= (transfer->dfs - 1);
+	}
 
 	return reg_val;
 }
 
+/* Helper : set the Tx FIFO start level in one TXFTLR write */
+static inline void set_tx_start_level(struct ospi_regs *ospi, uint32_t level)
+{
+	ospi->OSPI_TXFTLR = (ospi->OSPI_TXFTLR
+				& ~(0xFFU << SPI_TXFTLR_TXFTHR_SHIFT))
+				| (level << SPI_TXFTLR_TXFTHR_SHIFT);
+}
+
 /* Helper : value to set spi_ctrl0 */
 static uint32_t set_spi_ctrlr0_reg(struct ospi_transfer *transfer,
 				uint8_t inst_len)
@@ -61,8 +77,147 @@ static uint32_t set_ospi_ctrl0_in_xip(uint8_t frf,
 	return val;
 }
 
+/* Tx FIFO fill : frames from the Tx buffer */
+static void fifo_fill_buff(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer, uint32_t count)
+{
+	const uint32_t *buff = transfer->tx_buff;
+	uint32_t index;
+
+	for (index = 0; index < count; index++)
+		ospi->OSPI_DR0 = buff[index];
+
+	transfer->tx_buff = buff + count;
+	transfer->tx_current_cnt += count;
+}
+
+/* Tx FIFO fill : no Tx buffer, the default value */
+static void fifo_fill_default(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer, uint32_t count)
+{
+	const uint32_t val = transfer->tx_default_val;
+	uint32_t index;
+
+	for (index = 0; index < count; index++)
+		ospi->OSPI_DR0 = val;
+
+	transfer->tx_current_cnt += count;
+}
+
+/* Tx FIFO fill : no Tx buffer, no default value */
+static void fifo_fill_zero(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer, uint32_t count)
+{
+	uint32_t index;
+
+	for (index = 0; index < count; index++)
+		ospi->OSPI_DR0 = 0;
+
+	transfer->tx_current_cnt += count;
+}
+
+/* Rx FIFO drain : 32bit frames */
+static void fifo_drain_32(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer, uint32_t count)
+{
+	uint32_t *buff = (uint32_t *) transfer->rx_buff;
+	uint32_t index;
+
+	for (index = 0; index < count; index++)
+		buff[index] = ospi->OSPI_DR0;
+
+	transfer->rx_buff = buff + count;
+	transfer->rx_current_cnt += count;
+}
+
+/* Rx FIFO drain : 16bit frames */
+static void fifo_drain_16(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer, uint32_t count)
+{
+	uint16_t *buff = (uint16_t *) transfer->rx_buff;
+	uint32_t index;
+
+	for (index = 0; index < count; index++)
+		buff[index] = (uint16_t) ospi->OSPI_DR0;
+
+	transfer->rx_buff = buff + count;
+	transfer->rx_current_cnt += count;
+}
+
+/*
+ * Rx FIFO drain : 8bit frames
+ *
+ * It is observed that with DFS set to 8, the controller reads in 16bit
+ * frames. Workaround this by making two valid 8bit frames, high byte
+ * first, out of the DR content. The bounds check is done once per call:
+ * full pairs are copied two entries at a time and a trailing odd frame
+ * takes the high byte of one more entry.
+ */
+static void fifo_drain_8(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer, uint32_t count)
+{
+	uint8_t *buff = (uint8_t *) transfer->rx_buff;
+	uint32_t left = transfer->rx_total_cnt - transfer->rx_current_cnt;
+	uint32_t pairs = left / 2;
+	uint32_t val0, val1, index;
+
+	if (pairs > count)
+		pairs = count;
+
+	for (index = 0; index + 1 < pairs; index += 2) {
+		val0 = ospi->OSPI_DR0;
+		val1 = ospi->OSPI_DR0;
+
+		buff[0] = (uint8_t) (val0 >> 8);
+		buff[1] = (uint8_t) val0;
+		buff[2] = (uint8_t) (val1 >> 8);
+		buff[3] = (uint8_t) val1;
+		buff += 4;
+	}
+
+	if (index < pairs) {
+		val0 = ospi->OSPI_DR0;
+
+		buff[0] = (uint8_t) (val0 >> 8);
+		buff[1] = (uint8_t) val0;
+		buff += 2;
+	}
+
+	/* Odd frame count : the last entry holds a single frame */
+	if (pairs < count && (left & 1U)) {
+		val0 = ospi->OSPI_DR0;
+
+		*buff++ = (uint8_t) (val0 >> 8);
+	}
+
+	transfer->rx_current_cnt += (uint32_t) (buff
+				- (uint8_t *) transfer->rx_buff);
+	transfer->rx_buff = buff;
+}
+
+/* Helper : select the FIFO kernels for the coming transfer */
+static void set_fifo_kernels(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer)
+{
+	uint32_t frame_size = (SPI_CTRLR0_DFS_MASK & ospi->OSPI_CTRLR0);
+
+	if (transfer->tx_buff != NULL)
+		transfer->tx_fill = fifo_fill_buff;
+	else if (transfer->tx_default_enable == true)
+		transfer->tx_fill = fifo_fill_default;
+	else
+		transfer->tx_fill = fifo_fill_zero;
+
+	if (frame_size > SPI_CTRLR0_DFS_16bit)
+		transfer->rx_drain = fifo_drain_32;
+	else if (frame_size > SPI_CTRLR0_DFS_8bit)
+		transfer->rx_drain = fifo_drain_16;
+	else
+		transfer->rx_drain = fifo_drain_8;
+}
+
 /* Helper : value to ospi_xip_ctrl0 for XiP */
-static uint32_t set_xip_ctrl(uint8_t wait_cycles, uint8_t rxds_vl_en)
+static uint32_t set_xip_ctrl(const struct ospi_xip_config *xfg)
 {
 	uint32_t val;
 
@@ -71,18 +226,18 @@ static uint32_t set_xip_ctrl(uint8_t wait_cycles, uint8_t rxds_vl_en)
 	| (XIP_CTRL_ADDR_LEN_36_BIT << XIP_CTRL_ADDR_L_OFFSET)
 	| (XIP_CTRL_INST_LEN_8_BIT << XIP_CTRL_INST_L_OFFSET)
 	| (0x0 << XIP_CTRL_MD_BITS_EN_OFFSET)
-	| (wait_cycles << XIP_CTRL_WAIT_CYCLES_OFFSET)
+	| (xfg->xip_wait_cycles << XIP_CTRL_WAIT_CYCLES_OFFSET)
 	| (0x1 << XIP_CTRL_DFS_HC_OFFSET)
 	| (0x1 << XIP_CTRL_DDR_EN_OFFSET)
 	| (0x0 << XIP_CTRL_INST_DDR_EN_OFFSET)
 	| (0x1 << XIP_CTRL_RXDS_EN_OFFSET)
 	| (0x1 << XIP_CTRL_INST_EN_OFFSET)
-	| (0x0 << XIP_CTRL_CONT_XFER_EN_OFFSET)
+	| ((xfg->xip_cont_xfer_en & 0x1) << XIP_CTRL_CONT_XFER_EN_OFFSET)
 	| (0x0 << XIP_CTRL_XIP_HYPERBUS_EN_OFFSET)
 	| (0x0 << XIP_CTRL_RXDS_SIG_EN_OFFSET)
-	| (0x0 << XIP_CTRL_XIP_MBL_OFFSET)
-	| (0x0 << XIP_CTRL_XIP_PREFETCH_EN_OFFSET)
-	| (rxds_vl_en << XIP_CTRL_RXDS_VL_EN_OFFSET);
+	| ((xfg->xip_mbl & 0x3) << XIP_CTRL_XIP_MBL_OFFSET)
+	| ((xfg->xip_prefetch_en & 0x1) << XIP_CTRL_XIP_PREFETCH_EN_OFFSET)
+	| (xfg->xip_rxds_vl_en << XIP_CTRL_RXDS_VL_EN_OFFSET);
 
 	return val;
 }
@@ -98,8 +253,6 @@ void ospi_set_mode(struct ospi_regs *ospi, enum spi_mode mode)
 {
 	uint32_t val;
 
-	ospi_disable(ospi);
-
 	val = ospi->OSPI_CTRLR0;
 	val &= ~(SPI_CTRLR0_SCPOL_HIGH | SPI_CTRLR0_SCPH_HIGH);
 
@@ -124,6 +277,11 @@ void ospi_set_mode(struct ospi_regs *ospi, enum spi_mode mode)
 		break;
 	}
 
+	/* Unchanged : skip the disable cycle */
+	if (val == ospi->OSPI_CTRLR0)
+		return;
+
+	ospi_disable(ospi);
 	ospi->OSPI_CTRLR0 = val;
 	ospi_enable(ospi);
 }
@@ -139,11 +297,15 @@ void ospi_set_dfs(struct ospi_regs *ospi, uint8_t dfs)
 {
 	uint32_t val = 0;
 
-	ospi_disable(ospi);
-
 	val = ospi->OSPI_CTRLR0;
 	val &= ~SPI_CTRLR0_DFS_MASK;
 	val |= (dfs - 1);
+
+	/* Unchanged : skip the disable cycle */
+	if (val == ospi->OSPI_CTRLR0)
+		return;
+
+	ospi_disable(ospi);
 	ospi->OSPI_CTRLR0 = val;
 
 	ospi_enable(ospi);
@@ -160,8 +322,6 @@ void ospi_set_tmod(struct ospi_regs *ospi, enum spi_tmode tmod)
 {
 	uint32_t val = 0;
 
-	ospi_disable(ospi);
-
 	val = ospi->OSPI_CTRLR0;
 	val &= ~(SPI_CTRLR0_TMOD_MASK);
 
@@ -181,6 +341,12 @@ void ospi_set_tmod(struct ospi_regs *ospi, enum spi_tmode tmod)
 	default:
 	break;
 	}
+
+	/* Unchanged : skip the disable cycle */
+	if (val == ospi->OSPI_CTRLR0)
+		return;
+
+	ospi_disable(ospi);
 	ospi->OSPI_CTRLR0 = val;
 
 	ospi_enable(ospi);
@@ -290,7 +456,7 @@ void ospi_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi_disable(ospi);
 
 	ospi->OSPI_CTRLR0 = update_ctrl0_frf_tmode(ospi->OSPI_CTRLR0,
-					transfer->spi_frf,
+					transfer,
 					SPI_CTRLR0_TMOD_SEND_ONLY);
 
 	ospi->OSPI_CTRLR1 = 0;
@@ -298,6 +464,8 @@ void ospi_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi->OSPI_SPI_CTRLR0 = set_spi_ctrlr0_reg(transfer,
 			transfer->inst_len);
 
+	set_fifo_kernels(ospi, transfer);
+
 	//Unmask Tx interrupts.
 	ospi->OSPI_IMR = TX_INTR_MASK;
 
@@ -317,7 +485,7 @@ void ospi_receive(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi_disable(ospi);
 
 	ospi->OSPI_CTRLR0 = update_ctrl0_frf_tmode(ospi->OSPI_CTRLR0,
-					transfer->spi_frf,
+					transfer,
 					SPI_CTRLR0_TMOD_RECEIVE_ONLY);
 
 	ospi->OSPI_CTRLR1 = transfer->rx_total_cnt - 1;
@@ -325,6 +493,8 @@ void ospi_receive(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi->OSPI_SPI_CTRLR0 = set_spi_ctrlr0_reg(transfer,
 			transfer->inst_len);
 
+	set_fifo_kernels(ospi, transfer);
+
 	//Unmask Tx and Rx interrupts.
 	ospi->OSPI_IMR = TX_INTR_MASK | RX_INTR_MASK;
 
@@ -344,7 +514,7 @@ void ospi_transfer(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi_disable(ospi);
 
 	ospi->OSPI_CTRLR0 = update_ctrl0_frf_tmode(ospi->OSPI_CTRLR0,
-					transfer->spi_frf,
+					transfer,
 					SPI_CTRLR0_TMOD_RECEIVE_ONLY);
 
 	ospi->OSPI_CTRLR1 = transfer->rx_total_cnt - 1;
@@ -352,6 +522,8 @@ void ospi_transfer(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi->OSPI_SPI_CTRLR0 = set_spi_ctrlr0_reg(transfer,
 			transfer->inst_len);
 
+	set_fifo_kernels(ospi, transfer);
+
 	ospi->OSPI_IMR = TX_INTR_MASK | RX_INTR_MASK;
 
 	ospi_enable(ospi);
@@ -367,21 +539,27 @@ void ospi_transfer(struct ospi_regs *ospi, struct ospi_transfer *transfer)
  */
 void ospi_dma_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 {
+	uint32_t start_level;
+
 	ospi_disable(ospi);
 
 	ospi->OSPI_CTRLR0 = update_ctrl0_frf_tmode(ospi->OSPI_CTRLR0,
-					transfer->spi_frf,
+					transfer,
 					SPI_CTRLR0_TMOD_SEND_ONLY);
 
 	ospi->OSPI_SPI_CTRLR0 = set_spi_ctrlr0_reg(transfer,
 						SPI_CTRLR0_INST_L_8bit);
 
+	set_fifo_kernels(ospi, transfer);
+
 	ospi->OSPI_IMR = SPI_IMR_TX_FIFO_OVER_FLOW_INTERRUPT_MASK;
 
-	ospi->OSPI_TXFTLR &= ~(0xFFU << SPI_TXFTLR_TXFTHR_SHIFT);
+	/* Start level can not exceed the FIFO for DMA fed long sends */
+	start_level = transfer->tx_total_cnt;
+	if (start_level > OSPI_TX_FIFO_DEPTH)
+		start_level = OSPI_TX_FIFO_DEPTH;
 
-	ospi->OSPI_TXFTLR |=
-		((transfer->tx_total_cnt - 1U) << SPI_TXFTLR_TXFTHR_SHIFT);
+	set_tx_start_level(ospi, start_level - 1U);
 
 	ospi_enable_tx_dma(ospi);
 
@@ -401,7 +579,7 @@ void ospi_dma_transfer(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi_disable(ospi);
 
 	ospi->OSPI_CTRLR0 = update_ctrl0_frf_tmode(ospi->OSPI_CTRLR0,
-					transfer->spi_frf,
+					transfer,
 					SPI_CTRLR0_TMOD_RECEIVE_ONLY);
 
 	ospi->OSPI_CTRLR1 = transfer->rx_total_cnt - 1;
@@ -409,10 +587,9 @@ void ospi_dma_transfer(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	ospi->OSPI_SPI_CTRLR0 = set_spi_ctrlr0_reg(transfer,
 						SPI_CTRLR0_INST_L_8bit);
 
-	ospi->OSPI_TXFTLR &= ~(0xFFU << SPI_TXFTLR_TXFTHR_SHIFT);
+	set_tx_start_level(ospi, transfer->tx_total_cnt - 1U);
 
-	ospi->OSPI_TXFTLR |=
-		((transfer->tx_total_cnt - 1U) << SPI_TXFTLR_TXFTHR_SHIFT);
+	set_fifo_kernels(ospi, transfer);
 
 	ospi->OSPI_IMR = SPI_IMR_RX_FIFO_UNDER_FLOW_INTERRUPT_MASK
 			| SPI_IMR_RX_FIFO_OVER_FLOW_INTERRUPT_MASK
@@ -546,24 +723,21 @@ void ospi_psram_xip_init(struct ospi_regs *ospi,
 	ospi_enable(ospi);
 }
 
-/**
-  \fn          void ospi_hyperbus_send(struct ospi_regs *spi, struct ospi_transfer *transfer)
-  \brief       Prepare the OSPI Hyperbus for transmission
-  \param[in]   ospi       Pointer to the OSPI register map
-  \param[in]   transfer   Transfer parameters
-  \return      none
-*/
-void ospi_hyperbus_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
+/* Helper : program CTRLR0/SPI_CTRLR0 for a Hyperbus write, OSPI disabled */
+static void hyperbus_setup_send(struct ospi_regs *ospi,
+				struct ospi_transfer *transfer)
 {
-	uint32_t val, tx_count, curr_fifo_level;
-
-	ospi_disable(ospi);
+	uint32_t val;
 
 	val = ospi->OSPI_CTRLR0;
 	val &= ~(SPI_CTRLR0_SPI_FRF_MASK | (SPI_CTRLR0_TMOD_MASK | SPI_CTRLR0_SSTE_MASK));
 	val |= ((transfer->spi_frf << SPI_CTRLR0_SPI_FRF)
 			| SPI_CTRLR0_TMOD_SEND_ONLY
 			| SPI_CTRLR0_SPI_HYPERBUS_ENABLE);
+	if (transfer->dfs != 0) {
+		val &= ~SPI_CTRLR0_DFS_MASK;
+		val |= (transfer->dfs - 1);
+	}
 	ospi->OSPI_CTRLR0 = val;
 
 	val = SPI_TRANS_TYPE_FRF_DEFINED
@@ -573,6 +747,22 @@ void ospi_hyperbus_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 			| (transfer->dummy_cycle << SPI_CTRLR0_WAIT_CYCLES_OFFSET);
 
 	ospi->OSPI_SPI_CTRLR0 = val;
+}
+
+/**
+  \fn          void ospi_hyperbus_send(struct ospi_regs *spi, struct ospi_transfer *transfer)
+  \brief       Prepare the OSPI Hyperbus for transmission
+  \param[in]   ospi       Pointer to the OSPI register map
+  \param[in]   transfer   Transfer parameters
+  \return      none
+*/
+void ospi_hyperbus_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
+{
+	uint32_t tx_count, curr_fifo_level;
+
+	ospi_disable(ospi);
+
+	hyperbus_setup_send(ospi, transfer);
 
 	ospi_enable(ospi);
 
@@ -590,7 +780,7 @@ void ospi_hyperbus_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 			tx_count = (transfer->tx_total_cnt - transfer->tx_current_cnt);
 		}
 
-		ospi->OSPI_TXFTLR |= ((tx_count - 1U) << SPI_TXFTLR_TXFTHR_SHIFT);
+		set_tx_start_level(ospi, tx_count - 1U);
 
 		for (int i = 0; i < tx_count; i++) {
 			ospi->OSPI_DR0 = transfer->tx_buff[0];
@@ -603,6 +793,64 @@ void ospi_hyperbus_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 	}
 }
 
+/**
+  \fn          void ospi_hyperbus_send_async(struct ospi_regs *ospi,
+						struct ospi_transfer *transfer)
+  \brief       Prepare the OSPI Hyperbus for an interrupt driven
+		transmission, completed through ospi_irq_handler
+  \param[in]   ospi       Pointer to the OSPI register map
+  \param[in]   transfer   Transfer parameters
+  \return      none
+*/
+void ospi_hyperbus_send_async(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer)
+{
+	ospi_disable(ospi);
+
+	hyperbus_setup_send(ospi, transfer);
+
+	transfer->mode = SPI_TMOD_TX;
+	set_fifo_kernels(ospi, transfer);
+
+	//Unmask Tx interrupts.
+	ospi->OSPI_IMR = TX_INTR_MASK;
+
+	ospi_enable(ospi);
+}
+
+/**
+  \fn          void ospi_hyperbus_dma_send(struct ospi_regs *ospi,
+						struct ospi_transfer *transfer)
+  \brief       Prepare the OSPI Hyperbus for transmission with DMA support
+  \param[in]   ospi       Pointer to the OSPI register map
+  \param[in]   transfer   Transfer parameters
+  \return      none
+*/
+void ospi_hyperbus_dma_send(struct ospi_regs *ospi,
+			struct ospi_transfer *transfer)
+{
+	uint32_t start_level;
+
+	ospi_disable(ospi);
+
+	hyperbus_setup_send(ospi, transfer);
+
+	transfer->mode = SPI_TMOD_TX;
+	set_fifo_kernels(ospi, transfer);
+
+	ospi->OSPI_IMR = SPI_IMR_TX_FIFO_OVER_FLOW_INTERRUPT_MASK;
+
+	start_level = transfer->tx_total_cnt;
+	if (start_level > OSPI_TX_FIFO_DEPTH)
+		start_level = OSPI_TX_FIFO_DEPTH;
+
+	set_tx_start_level(ospi, start_level - 1U);
+
+	ospi_enable_tx_dma(ospi);
+
+	ospi_enable(ospi);
+}
+
 /**
  * \fn          void ospi_irq_handler(struct ospi_regs *ospi,
  *                                    struct ospi_transfer *transfer)
@@ -613,14 +861,11 @@ void ospi_hyperbus_send(struct ospi_regs *ospi, struct ospi_transfer *transfer)
  */
 void ospi_irq_handler(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 {
-	uint32_t event, tx_data, index, rx_count, tx_count;
-	uint16_t frame_size;
+	uint32_t event, rx_count, tx_count;
 
 	event = ospi->OSPI_ISR;
 
 	if (event & SPI_TX_FIFO_EMPTY_EVENT) {
-		frame_size = (SPI_CTRLR0_DFS_MASK & ospi->OSPI_CTRLR0);
-
 		/* Calculate data count to transfer */
 		if (transfer->tx_total_cnt >=
 			(transfer->tx_current_cnt + OSPI_TX_FIFO_DEPTH)) {
@@ -630,82 +875,19 @@ void ospi_irq_handler(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 					- transfer->tx_current_cnt);
 		}
 
-		ospi->OSPI_TXFTLR &= ~(0xFFU << SPI_TXFTLR_TXFTHR_SHIFT);
-		ospi->OSPI_TXFTLR |=
-				((tx_count - 1U) << SPI_TXFTLR_TXFTHR_SHIFT);
-
-		for (index = 0; index < tx_count; index++) {
-			tx_data = 0;
-
-			if (transfer->tx_buff == NULL) {
-				/* Is the default buffer transmit enabled */
-				if (transfer->tx_default_enable == true) {
-					tx_data = transfer->tx_default_val;
-				}
-			} else {
-				tx_data = transfer->tx_buff[0];
-				transfer->tx_buff = (transfer->tx_buff + 1);
-			}
+		/* Nothing left to push, e.g. a DMA fed send draining out */
+		if (tx_count != 0) {
+			set_tx_start_level(ospi, tx_count - 1U);
 
-			ospi->OSPI_DR0 = tx_data;
-			transfer->tx_current_cnt++;
+			transfer->tx_fill(ospi, transfer, tx_count);
 		}
 	}
 
 	if (event & SPI_RX_FIFO_FULL_EVENT) {
-		frame_size = (SPI_CTRLR0_DFS_MASK & ospi->OSPI_CTRLR0);
-
 		rx_count = ospi->OSPI_RXFLR;
 
-		if (frame_size > SPI_CTRLR0_DFS_16bit) {
-			for (index = 0; index < rx_count; index++) {
-				*((uint32_t *) transfer->rx_buff) =
-							ospi->OSPI_DR0;
-
-				transfer->rx_buff =
-					(uint8_t *) transfer->rx_buff
-						+ sizeof(uint32_t);
-				transfer->rx_current_cnt++;
-			}
-		} else if (frame_size > SPI_CTRLR0_DFS_8bit) {
-			for (index = 0; index < rx_count; index++) {
-				*((uint16_t *) transfer->rx_buff) =
-					(uint16_t) (ospi->OSPI_DR0);
-
-				transfer->rx_buff =
-					(uint8_t *) transfer->rx_buff
-						+ sizeof(uint16_t);
-				transfer->rx_current_cnt++;
-			}
-		} else {
-			for (index = 0; index < rx_count; index++) {
-				/*
-				 * It is observed that with DFS set to 8,
-				 * the controller reads in 16bit frames.
-				 * Workaround this by making two valid
-				 * 8bit frames out of the DR content.
-				 */
-				uint32_t val = ospi->OSPI_DR0;
-
-				*((uint8_t *) transfer->rx_buff) =
-					(uint8_t) ((val >> 8) & 0xff);
-				transfer->rx_buff =
-					(uint8_t *) transfer->rx_buff
-						+ sizeof(uint8_t);
-				transfer->rx_current_cnt++;
-
-				if (transfer->rx_current_cnt ==
-					transfer->rx_total_cnt)
-					break;
-
-				*((uint8_t *) transfer->rx_buff) =
-					(uint8_t) (val & 0xff);
-				transfer->rx_buff =
-					(uint8_t *) transfer->rx_buff
-						+ sizeof(uint8_t);
-				transfer->rx_current_cnt++;
-			}
-		}
+		if (rx_count != 0)
+			transfer->rx_drain(ospi, transfer, rx_count);
 	}
 
 	if (event &
@@ -758,13 +940,14 @@ void ospi_irq_handler(struct ospi_regs *ospi, struct ospi_transfer *transfer)
 		transfer->status = SPI_TRANSFER_STATUS_COMPLETE;
 	}
 
-	if ((transfer->mode == SPI_TMOD_TX_AND_RX) &&
+	/* Command/Address sent : stop the Tx FIFO empty interrupts */
+	if ((transfer->mode == SPI_TMOD_TX_AND_RX ||
+		transfer->mode == SPI_TMOD_RX) &&
 		(transfer->tx_total_cnt == transfer->tx_current_cnt)) {
 		if ((ospi->OSPI_SR & SPI_SR_TX_FIFO_EMPTY) ==
 			 SPI_SR_TX_FIFO_EMPTY) {
 			/* Reset the Tx FIFO start level */
-			ospi->OSPI_TXFTLR &=
-				~(0xFFU << SPI_TXFTLR_TXFTHR_SHIFT);
+			set_tx_start_level(ospi, 0);
 
 			/* Mask the TX interrupts */
 			ospi->OSPI_IMR &= ~(TX_INTR_MASK);
@@ -799,14 +982,17 @@ void ospi_xip_enable(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
 					TMODE_RD_ONLY, SPI_CTRLR0_DFS_16bit);
 
 	/* Set OSPI XIP CTRL */
-	ospi->OSPI_XIP_CTRL = set_xip_ctrl(xfg->xip_wait_cycles,
-					xfg->xip_rxds_vl_en);
+	ospi->OSPI_XIP_CTRL = set_xip_ctrl(xfg);
 
 	ospi->OSPI_XIP_INCR_INST = xfg->incr_cmd;
 	ospi->OSPI_XIP_WRAP_INST = xfg->wrap_cmd;
 	ospi->OSPI_XIP_MODE_BITS = xfg->xip_mod_bits;
 	ospi->OSPI_RX_SAMPLE_DELAY = xfg->rx_smpl_dlay;
 
+	/* CS de-assert timeout of continuous transfers */
+	ospi->OSPI_XIP_CNT_TIME_OUT = xfg->xip_cnt_time_out ?
+			xfg->xip_cnt_time_out : OSPI_XIP_CNT_TIME_OUT_DEFAULT;
+
 #ifndef CONFIG_FLASH_ADDRESS_IN_SINGLE_FIFO_LOCATION
 	ospi_control_xip_ss(ospi, xfg->xip_cs_pin, SPI_SS_STATE_ENABLE);
 #endif
@@ -855,7 +1041,8 @@ void ospi_xip_disable(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
 	ospi->OSPI_XIP_WRITE_INCR_INST = xfg->incr_cmd;
 	ospi->OSPI_XIP_WRAP_INST = xfg->wrap_cmd;
 
-	ospi->OSPI_XIP_CNT_TIME_OUT = 100;
+	ospi->OSPI_XIP_CNT_TIME_OUT = xfg->xip_cnt_time_out ?
+			xfg->xip_cnt_time_out : OSPI_XIP_CNT_TIME_OUT_DEFAULT;
 
 #ifndef CONFIG_FLASH_ADDRESS_IN_SINGLE_FIFO_LOCATION
 	ospi_control_xip_ss(ospi, xfg->xip_cs_pin, SPI_SS_STATE_ENABLE);
@@ -865,3 +1052,116 @@ void ospi_xip_disable(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
 	/* XiP Disable */
 	aes->AES_CTRL &= ~AES_CONTROL_XIP_EN;
 }
+
+/**
+ * \fn          void ospi_save_context(struct ospi_regs *ospi,
+ *                    struct ospi_aes_regs *aes, struct ospi_context *ctx)
+ * \brief       Snapshot the OSPI and AES configuration registers
+ * \param[in]   ospi Pointer to the OSPI register map
+ * \param[in]   aes  Pointer to the AES register map
+ * \param[out]  ctx  Snapshot, should live in retention memory
+ * \return      none
+ */
+void ospi_save_context(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
+		struct ospi_context *ctx)
+{
+#if defined(CONFIG_ENSEMBLE_GEN2)
+	volatile uint32_t *delay = &aes->AES_RXD_DELAY_0;
+	uint32_t i;
+#endif
+
+	ctx->ctrlr0 = ospi->OSPI_CTRLR0;
+	ctx->ctrlr1 = ospi->OSPI_CTRLR1;
+	ctx->enr = ospi->OSPI_ENR;
+	ctx->ser = ospi->OSPI_SER;
+	ctx->baudr = ospi->OSPI_BAUDR;
+	ctx->txftlr = ospi->OSPI_TXFTLR;
+	ctx->rxftlr = ospi->OSPI_RXFTLR;
+	ctx->imr = ospi->OSPI_IMR;
+	ctx->dmacr = ospi->OSPI_DMACR;
+	ctx->dmatdlr = ospi->OSPI_DMATDLR;
+	ctx->dmardlr = ospi->OSPI_DMARDLR;
+	ctx->rx_sample_delay = ospi->OSPI_RX_SAMPLE_DELAY;
+	ctx->spi_ctrlr0 = ospi->OSPI_SPI_CTRLR0;
+	ctx->ddr_drive_edge = ospi->OSPI_DDR_DRIVE_EDGE;
+	ctx->xip_mode_bits = ospi->OSPI_XIP_MODE_BITS;
+	ctx->xip_incr_inst = ospi->OSPI_XIP_INCR_INST;
+	ctx->xip_wrap_inst = ospi->OSPI_XIP_WRAP_INST;
+	ctx->xip_ctrl = ospi->OSPI_XIP_CTRL;
+	ctx->xip_ser = ospi->OSPI_XIP_SER;
+	ctx->xip_cnt_time_out = ospi->OSPI_XIP_CNT_TIME_OUT;
+	ctx->xip_write_incr_inst = ospi->OSPI_XIP_WRITE_INCR_INST;
+	ctx->xip_write_wrap_inst = ospi->OSPI_XIP_WRITE_WRAP_INST;
+	ctx->xip_write_ctrl = ospi->OSPI_XIP_WRITE_CTRL;
+
+	ctx->aes_ctrl = aes->AES_CTRL;
+	ctx->aes_intr_mask = aes->AES_INTR_MASK;
+	ctx->aes_addr_control = aes->AES_ADDR_CONTROL;
+	ctx->aes_rxds_dly = aes->AES_RXDS_DLY;
+#if defined(CONFIG_ENSEMBLE_GEN2)
+	for (i = 0; i < OSPI_CONTEXT_AES_DELAY_REGS; i++)
+		ctx->aes_delay[i] = delay[i];
+#endif
+
+	ctx->magic = OSPI_CONTEXT_MAGIC;
+}
+
+/**
+ * \fn          void ospi_restore_context(struct ospi_regs *ospi,
+ *                    struct ospi_aes_regs *aes,
+ *                    const struct ospi_context *ctx)
+ * \brief       Write a snapshot back with the controller disabled, then
+ *              re-enable it and XiP as they were when it was taken.
+ * \param[in]   ospi Pointer to the OSPI register map
+ * \param[in]   aes  Pointer to the AES register map
+ * \param[in]   ctx  Snapshot from ospi_save_context()
+ * \return      none
+ */
+void ospi_restore_context(struct ospi_regs *ospi, struct ospi_aes_regs *aes,
+		const struct ospi_context *ctx)
+{
+#if defined(CONFIG_ENSEMBLE_GEN2)
+	volatile uint32_t *delay = &aes->AES_RXD_DELAY_0;
+	uint32_t i;
+#endif
+
+	/* Pad timing first, the controller is not driving the bus yet */
+	aes->AES_RXDS_DLY = ctx->aes_rxds_dly;
+#if defined(CONFIG_ENSEMBLE_GEN2)
+	for (i = 0; i < OSPI_CONTEXT_AES_DELAY_REGS; i++)
+		delay[i] = ctx->aes_delay[i];
+#endif
+	aes->AES_INTR_MASK = ctx->aes_intr_mask;
+	aes->AES_ADDR_CONTROL = ctx->aes_addr_control;
+
+	/* Most registers are only writable while the SSI is disabled */
+	ospi_disable(ospi);
+
+	ospi->OSPI_CTRLR0 = ctx->ctrlr0;
+	ospi->OSPI_CTRLR1 = ctx->ctrlr1;
+	ospi->OSPI_BAUDR = ctx->baudr;
+	ospi->OSPI_TXFTLR = ctx->txftlr;
+	ospi->OSPI_RXFTLR = ctx->rxftlr;
+	ospi->OSPI_IMR = ctx->imr;
+	ospi->OSPI_DMACR = ctx->dmacr;
+	ospi->OSPI_DMATDLR = ctx->dmatdlr;
+	ospi->OSPI_DMARDLR = ctx->dmardlr;
+	ospi->OSPI_RX_SAMPLE_DELAY = ctx->rx_sample_delay;
+	ospi->OSPI_SPI_CTRLR0 = ctx->spi_ctrlr0;
+	ospi->OSPI_DDR_DRIVE_EDGE = ctx->ddr_drive_edge;
+	ospi->OSPI_XIP_MODE_BITS = ctx->xip_mode_bits;
+	ospi->OSPI_XIP_INCR_INST = ctx->xip_incr_inst;
+	ospi->OSPI_XIP_WRAP_INST = ctx->xip_wrap_inst;
+	ospi->OSPI_XIP_CTRL = ctx->xip_ctrl;
+	ospi->OSPI_XIP_CNT_TIME_OUT = ctx->xip_cnt_time_out;
+	ospi->OSPI_XIP_WRITE_INCR_INST = ctx->xip_write_incr_inst;
+	ospi->OSPI_XIP_WRITE_WRAP_INST = ctx->xip_write_wrap_inst;
+	ospi->OSPI_XIP_WRITE_CTRL = ctx->xip_write_ctrl;
+	ospi->OSPI_XIP_SER = ctx->xip_ser;
+	ospi->OSPI_SER = ctx->ser;
+
+	ospi->OSPI_ENR = ctx->enr;
+
+	/* XiP last, once the controller is fully configured */
+	aes->AES_CTRL = ctx->aes_ctrl;
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+
+#include "ospi_calib.h"
+
+/* Helper : checksum of a result, magic and data fields */
+static uint32_t result_checksum(const struct ospi_calib_result *res)
+{
+	uint32_t sum;
+
+	sum = res->magic;
+	sum = (sum << 5 | sum >> 27) ^ res->bus_speed;
+	sum = (sum << 5 | sum >> 27) ^ ((uint32_t) res->rx_sample_delay
+				| (uint32_t) res->rx_ds_delay << 8
+				| (uint32_t) res->margin << 16);
+
+	return ~sum;
+}
+
+/* Helper : pass flag of a point, false outside the sweep */
+static bool point_pass(const uint8_t *pass_map, uint32_t n_smpl,
+			uint32_t n_ds, int32_t x, int32_t y)
+{
+	if (x < 0 || y < 0 || (uint32_t) x >= n_smpl || (uint32_t) y >= n_ds)
+		return false;
+
+	return pass_map[y * n_smpl + x] != 0;
+}
+
+/*
+ * Helper : margin of a passing point, i.e. the L-infinity distance to
+ * the nearest failing point minus one. Beyond the border of a swept
+ * axis counts as failing. An axis with a single step is not swept and
+ * never limits the margin.
+ */
+static uint32_t point_margin(const uint8_t *pass_map, uint32_t n_smpl,
+			uint32_t n_ds, uint32_t smpl, uint32_t ds)
+{
+	int32_t x = smpl, y = ds, r, i, r_max;
+	bool sweep_x = n_smpl > 1, sweep_y = n_ds > 1;
+
+	r_max = (n_smpl > n_ds) ? n_smpl : n_ds;
+
+	for (r = 1; r < r_max; r++) {
+		if (sweep_x && (x < r || x + r >= (int32_t) n_smpl))
+			return r - 1;
+		if (sweep_y && (y < r || y + r >= (int32_t) n_ds))
+			return r - 1;
+
+		/* Rows ds - r and ds + r, only if Rx-DS is swept */
+		for (i = x - r; sweep_y && i <= x + r; i++) {
+			if ((sweep_x || i == x) &&
+				(!point_pass(pass_map, n_smpl, n_ds, i, y - r) ||
+				!point_pass(pass_map, n_smpl, n_ds, i, y + r)))
+				return r - 1;
+		}
+
+		/* Columns smpl - r and smpl + r, only if Rx sample is swept */
+		for (i = y - r; sweep_x && i <= y + r; i++) {
+			if ((sweep_y || i == y) &&
+				(!point_pass(pass_map, n_smpl, n_ds, x - r, i) ||
+				!point_pass(pass_map, n_smpl, n_ds, x + r, i)))
+				return r - 1;
+		}
+	}
+
+	return r_max - 1;
+}
+
+int32_t ospi_calib_find_center(const uint8_t *pass_map, uint32_t n_smpl,
+			uint32_t n_ds, uint32_t *smpl, uint32_t *ds)
+{
+	uint32_t x, y, margin, count = 0;
+	int64_t sum_x = 0, sum_y = 0, dx, dy, dist, best_dist = -1;
+	int32_t best = -1;
+
+	if (pass_map == NULL || smpl == NULL || ds == NULL ||
+		n_smpl == 0 || n_ds == 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	/* Largest margin and the centroid of the points that have it */
+	for (y = 0; y < n_ds; y++) {
+		for (x = 0; x < n_smpl; x++) {
+			if (!pass_map[y * n_smpl + x])
+				continue;
+
+			margin = point_margin(pass_map, n_smpl, n_ds, x, y);
+
+			if ((int32_t) margin > best) {
+				best = margin;
+				count = 0;
+				sum_x = 0;
+				sum_y = 0;
+			}
+			if ((int32_t) margin == best) {
+				count++;
+				sum_x += x;
+				sum_y += y;
+			}
+		}
+	}
+
+	/* Nothing passed */
+	if (best < 0)
+		return OSPI_ERR_INVALID_STATE;
+
+	/* Ties go to the point nearest that centroid, scaled by count */
+	for (y = 0; y < n_ds; y++) {
+		for (x = 0; x < n_smpl; x++) {
+			if (!pass_map[y * n_smpl + x] ||
+				(int32_t) point_margin(pass_map, n_smpl, n_ds,
+						x, y) != best)
+				continue;
+
+			dx = (int64_t) x * count - sum_x;
+			dy = (int64_t) y * count - sum_y;
+			dist = dx * dx + dy * dy;
+
+			if (best_dist < 0 || dist < best_dist) {
+				best_dist = dist;
+				*smpl = x;
+				*ds = y;
+			}
+		}
+	}
+
+	return best;
+}
+
+int32_t ospi_calib_run(HAL_OSPI_Handle_T handle,
+			const struct ospi_calib_config *cfg,
+			uint8_t *pass_map, struct ospi_calib_result *res)
+{
+	uint32_t n_smpl, n_ds, x, y, smpl, ds;
+	int32_t ret;
+
+	if (cfg == NULL || cfg->probe == NULL || pass_map == NULL ||
+		res == NULL || cfg->smpl_max < cfg->smpl_min ||
+		cfg->ds_max < cfg->ds_min)
+		return OSPI_ERR_INVALID_PARAM;
+
+	n_smpl = cfg->smpl_max - cfg->smpl_min + 1;
+	n_ds = cfg->ds_max - cfg->ds_min + 1;
+
+	for (y = 0; y < n_ds; y++) {
+		for (x = 0; x < n_smpl; x++) {
+			ret = alif_hal_ospi_set_rx_delays(handle,
+					cfg->smpl_min + x, cfg->ds_min + y);
+			if (ret != OSPI_ERR_NONE)
+				return ret;
+
+			pass_map[y * n_smpl + x] =
+				(cfg->probe(handle, cfg->ctx) == OSPI_ERR_NONE);
+		}
+	}
+
+	ret = ospi_calib_find_center(pass_map, n_smpl, n_ds, &smpl, &ds);
+	if (ret < 0)
+		return ret;
+
+	res->bus_speed = cfg->bus_speed;
+	res->rx_sample_delay = cfg->smpl_min + smpl;
+	res->rx_ds_delay = cfg->ds_min + ds;
+	res->margin = (ret > UINT8_MAX) ? UINT8_MAX : ret;
+	res->reserved = 0;
+	ospi_calib_result_seal(res);
+
+	return alif_hal_ospi_set_rx_delays(handle, res->rx_sample_delay,
+					res->rx_ds_delay);
+}
+
+void ospi_calib_result_seal(struct ospi_calib_result *res)
+{
+	res->magic = OSPI_CALIB_MAGIC;
+	res->checksum = result_checksum(res);
+}
+
+bool ospi_calib_result_valid(const struct ospi_calib_result *res,
+			uint32_t bus_speed)
+{
+	if (res == NULL || res->magic != OSPI_CALIB_MAGIC)
+		return false;
+
+	if (res->checksum != result_checksum(res))
+		return false;
+
+	return res->bus_speed == bus_speed;
+}
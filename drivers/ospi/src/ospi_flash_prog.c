@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "ospi_flash_prog.h"
+
+enum flash_prog_state {
+	FLASH_PROG_IDLE,                /* No job */
+	FLASH_PROG_PROGRAM,             /* Write enable + program running */
+	FLASH_PROG_WAIT,                /* Timer running before a poll */
+	FLASH_PROG_POLL,                /* Status read running */
+};
+
+/* Helper : bytes per program frame */
+static inline uint32_t prog_frame_bytes(const struct ospi_flash_prog *eng)
+{
+	return eng->cfg.prog_conf->frame_size / 8;
+}
+
+/* Helper : finish the job */
+static void prog_done(struct ospi_flash_prog *eng, int32_t status)
+{
+	eng->state = FLASH_PROG_IDLE;
+	eng->left = 0;
+	eng->next_frames = 0;
+
+	if (eng->cfg.done_cb != NULL)
+		eng->cfg.done_cb(status, eng->cfg.ctx);
+}
+
+/*
+ * Helper : pack the next page into the staging buffer not on the bus.
+ * The chunk ends at the page boundary.
+ */
+static void pack_next_page(struct ospi_flash_prog *eng)
+{
+	uint32_t fb = prog_frame_bytes(eng);
+	uint32_t *frame = eng->cfg.stage[eng->cur_stage ^ 1];
+	uint32_t len, index, byte, val;
+
+	if (eng->left == 0) {
+		eng->next_frames = 0;
+		return;
+	}
+
+	len = eng->cfg.page_size - (eng->addr & (eng->cfg.page_size - 1));
+	if (len > eng->left)
+		len = eng->left;
+
+	frame[0] = eng->cfg.cmd_prog;
+	frame[1] = eng->addr;
+
+	for (index = 0; index < len / fb; index++) {
+		val = 0;
+		for (byte = 0; byte < fb; byte++)
+			val = (val << 8) | *eng->src++;
+
+		frame[2 + index] = val;
+	}
+
+	eng->addr += len;
+	eng->left -= len;
+	eng->next_frames = 2 + len / fb;
+}
+
+/* Helper : queue a status read */
+static int32_t queue_poll(struct ospi_flash_prog *eng)
+{
+	eng->polls++;
+	eng->state = FLASH_PROG_POLL;
+
+	return alif_hal_ospi_queue_transfer(eng->cfg.handle, &eng->desc[2]);
+}
+
+/* Helper : start the timer of the next status read */
+static int32_t wait_poll(struct ospi_flash_prog *eng, uint32_t us)
+{
+	int32_t ret;
+
+	eng->state = FLASH_PROG_WAIT;
+
+	ret = eng->cfg.start_timer(us, eng->cfg.ctx);
+	if (ret != OSPI_ERR_NONE)
+		eng->timer_errors++;
+
+	return ret;
+}
+
+/* Helper : queue the chain of the packed page */
+static int32_t queue_page(struct ospi_flash_prog *eng)
+{
+	eng->cur_stage ^= 1;
+	eng->desc[1].data_out = eng->cfg.stage[eng->cur_stage];
+	eng->desc[1].num = eng->next_frames;
+	eng->next_frames = 0;
+
+	eng->state = FLASH_PROG_PROGRAM;
+
+	/* Write enable and program as one unit, completed together */
+	return alif_hal_ospi_queue_chain(eng->cfg.handle, &eng->desc[0], 2);
+}
+
+int32_t ospi_flash_prog_init(struct ospi_flash_prog *eng,
+			const struct ospi_flash_prog_cfg *cfg)
+{
+	uint32_t fb;
+
+	if (eng == NULL || cfg == NULL || cfg->cmd_conf == NULL ||
+		cfg->prog_conf == NULL || cfg->status_conf == NULL ||
+		cfg->stage[0] == NULL || cfg->stage[1] == NULL ||
+		cfg->start_timer == NULL)
+		return OSPI_ERR_INVALID_PARAM;
+
+	fb = cfg->prog_conf->frame_size / 8;
+	if (fb == 0 || fb > sizeof(uint32_t) ||
+		cfg->page_size < fb ||
+		(cfg->page_size & (cfg->page_size - 1)) != 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	memset(eng, 0, sizeof(struct ospi_flash_prog));
+	eng->cfg = *cfg;
+
+	eng->wren_frame = cfg->cmd_wren;
+
+	eng->desc[0].type = OSPI_DESC_SEND;
+	eng->desc[0].trans_conf = cfg->cmd_conf;
+	eng->desc[0].data_out = &eng->wren_frame;
+	eng->desc[0].num = 1;
+
+	eng->desc[1].type = OSPI_DESC_SEND;
+	eng->desc[1].trans_conf = cfg->prog_conf;
+
+	eng->desc[2].type = OSPI_DESC_RECEIVE;
+	eng->desc[2].trans_conf = cfg->status_conf;
+	eng->desc[2].cmd = cfg->cmd_rdsr;
+	eng->desc[2].addr = cfg->rdsr_addr;
+	eng->desc[2].data_in = &eng->status;
+	eng->desc[2].num = 1;
+
+	return OSPI_ERR_NONE;
+}
+
+int32_t ospi_flash_prog_start(struct ospi_flash_prog *eng, uint32_t addr,
+			const void *data, uint32_t len)
+{
+	uint32_t fb;
+	int32_t ret;
+
+	if (eng == NULL || data == NULL || len == 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	fb = prog_frame_bytes(eng);
+	if ((addr % fb) != 0 || (len % fb) != 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	if (eng->state != FLASH_PROG_IDLE)
+		return OSPI_ERR_CTRL_BUSY;
+
+	eng->src = data;
+	eng->addr = addr;
+	eng->left = len;
+	eng->pages = 0;
+	eng->polls = 0;
+	eng->timer_errors = 0;
+
+	pack_next_page(eng);
+
+	ret = queue_page(eng);
+	if (ret != OSPI_ERR_NONE) {
+		eng->state = FLASH_PROG_IDLE;
+		eng->left = 0;
+	}
+
+	return ret;
+}
+
+bool ospi_flash_prog_busy(const struct ospi_flash_prog *eng)
+{
+	return eng->state != FLASH_PROG_IDLE;
+}
+
+void ospi_flash_prog_timer_expired(struct ospi_flash_prog *eng)
+{
+	int32_t ret;
+
+	if (eng == NULL || eng->state != FLASH_PROG_WAIT)
+		return;
+
+	eng->status = 0;
+	ret = queue_poll(eng);
+	if (ret != OSPI_ERR_NONE)
+		prog_done(eng, ret);
+}
+
+void ospi_flash_prog_event(uint32_t event, void *u_data)
+{
+	struct ospi_flash_prog *eng = u_data;
+	int32_t ret = OSPI_ERR_NONE;
+
+	if (eng == NULL || eng->state == FLASH_PROG_IDLE)
+		return;
+
+	if (event & (OSPI_EVENT_DATA_LOST | OSPI_EVENT_MODE_FAULT)) {
+		prog_done(eng, OSPI_ERR_INVALID_STATE);
+		return;
+	}
+
+	if (!(event & OSPI_EVENT_TRANSFER_COMPLETE))
+		return;
+
+	switch (eng->state) {
+	case FLASH_PROG_PROGRAM:
+		/* Flash is busy now, pack the next page before the first poll */
+		pack_next_page(eng);
+		ret = wait_poll(eng, eng->cfg.poll_delay_us);
+		break;
+
+	case FLASH_PROG_POLL:
+		if (eng->status & eng->cfg.wip_mask) {
+			ret = wait_poll(eng, eng->cfg.poll_interval_us);
+			break;
+		}
+
+		eng->pages++;
+
+		if (eng->next_frames == 0) {
+			prog_done(eng, OSPI_ERR_NONE);
+			return;
+		}
+
+		ret = queue_page(eng);
+		break;
+
+	default:
+		break;
+	}
+
+	if (ret != OSPI_ERR_NONE)
+		prog_done(eng, ret);
+}
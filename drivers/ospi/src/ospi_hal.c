@@ -4,10 +4,16 @@
  */
 
 #include <string.h>
+#include <cmsis_core.h>
 
 #include "ospi_hal.h"
 
+#ifdef CONFIG_ALIF_OSPI_DT_INSTANCES
+#include <zephyr/devicetree.h>
+#endif
+
 #define HAL_OSPI_MAX_INST                   2
+#define HAL_OSPI_DESC_QUEUE_LEN             8
 #define HAL_OSPI_INVALID_INST               -1
 #define HAL_OSPI_AES_RX_DS_DELAY_REG_OFFSET 0x20
 
@@ -22,35 +28,376 @@ struct hal_ospi_inst {
 	uint32_t  rx_sample_delay;
 	uint32_t  ddr_drive_edge;
 	uint32_t  core_clk;
+	uint32_t  tx_dma_level;
+	uint32_t  rx_dma_level;
 	uint32_t  *aes_regs;
 
 	/* Data Transfer */
 	struct ospi_transfer transfer;
 
+	/* Receive only streaming */
+	uint32_t  rx_cmd[4];               /* Command and Address frames */
+	uint32_t  rx_addr;                 /* Address of the next chunk */
+	uint32_t  rx_pending;              /* Frames left after this chunk */
+	uint32_t  rx_frame_bytes;          /* Bytes per data frame */
+
+	/* Descriptor Queue */
+	struct ospi_xfer_desc desc_queue[HAL_OSPI_DESC_QUEUE_LEN];
+	uint8_t   desc_head;               /* Next descriptor to start */
+	uint8_t   desc_count;              /* Descriptors waiting */
+	volatile uint8_t desc_active;      /* A queued descriptor is running */
+	uint8_t   desc_notify;             /* Running one asks for an event */
+
 	/* XiP Config*/
 	struct ospi_xip_config   xip_config;
+	uint8_t   xip_suspend_cnt;         /* XiP suspend nesting */
+
+#ifdef CONFIG_ALIF_OSPI_STATS
+	/* Statistics */
+	struct ospi_stats stats;
+	uint32_t  (*get_cycles)(void);     /* Latency time source */
+	uint32_t  xfer_start;              /* Cycles at transfer start */
+	uint32_t  xfer_bytes;              /* Bytes of the running transfer */
+	uint32_t  xfer_irqs;               /* IRQs of the running transfer */
+	uint8_t   xfer_in_flight;          /* A transfer is accounted */
+#endif
 
 	/* Event Notifier */
 	hal_event_notify_cb *event_cb;
 	void  *user_data;
 };
 
+#ifdef CONFIG_ALIF_OSPI_DT_INSTANCES
+/*
+ * Instances generated from devicetree: handle n is node label ospi<n>.
+ * The register blocks live in a const table, the RAM instance only holds
+ * run state. Disabled nodes can not be claimed or released.
+ */
+#define OSPI_DT_NODE(n)        DT_NODELABEL(ospi##n)
+#define OSPI_DT_OKAY(n)        DT_NODE_HAS_STATUS(OSPI_DT_NODE(n), okay)
+#define OSPI_DT_REG(n, idx)                                                \
+	COND_CODE_1(OSPI_DT_OKAY(n),                                       \
+		    (DT_REG_ADDR_BY_IDX(OSPI_DT_NODE(n), idx)), (0))
+
+/** OSPI_Instance constant data */
+struct hal_ospi_dt_cfg {
+	uintptr_t regs;                    /* OSPI register block, reg[0] */
+	uintptr_t aes_regs;                /* AES register block, reg[1] */
+};
+
+static const struct hal_ospi_dt_cfg ospi_dt_cfg[HAL_OSPI_MAX_INST] = {
+	{.regs = OSPI_DT_REG(0, 0), .aes_regs = OSPI_DT_REG(0, 1)},
+	{.regs = OSPI_DT_REG(1, 0), .aes_regs = OSPI_DT_REG(1, 1)}
+};
+
+struct hal_ospi_inst
+	g_ospi_instance[HAL_OSPI_MAX_INST] = {
+		{.is_avail = OSPI_DT_OKAY(0)},
+		{.is_avail = OSPI_DT_OKAY(1)}
+	};
+#else
 /* Fixed Instances */
 struct hal_ospi_inst
 	g_ospi_instance[HAL_OSPI_MAX_INST] = {
 		{.is_avail = 1},
 		{.is_avail = 1}
 	};
+#endif
 
 /* Helper : To fetch Instnace from Handle. */
-static struct hal_ospi_inst *get_inst_by_handle(HAL_OSPI_Handle_T handle)
+static inline struct hal_ospi_inst *get_inst_by_handle(HAL_OSPI_Handle_T handle)
 {
-	if (handle >= HAL_OSPI_MAX_INST)
+	/* Unsigned compare also rejects negative (invalid) handles. */
+	if ((uint8_t) handle >= HAL_OSPI_MAX_INST)
 		return NULL;
 
 	return &(g_ospi_instance[handle]);
 }
 
+/* Helper : Tx total count (command + address frames) based on address length */
+static void set_tx_total_cnt(struct ospi_transfer *transfer)
+{
+	if (transfer->addr_len == OSPI_ADDR_LENGTH_0_BITS)
+		transfer->tx_total_cnt = 1;
+	else if (transfer->addr_len == OSPI_ADDR_LENGTH_24_BITS)
+		transfer->tx_total_cnt = 4;
+	else if (transfer->addr_len == OSPI_ADDR_LENGTH_32_BITS)
+		transfer->tx_total_cnt = 2;
+}
+
+/*
+ * Helper : Command and address frames of a Receive only read, laid out
+ * as set_tx_total_cnt() counts them. A 24 bit address goes out as three
+ * byte frames, most significant first.
+ */
+static void set_rx_cmd(struct hal_ospi_inst *ospi_inst)
+{
+	uint32_t addr = ospi_inst->rx_addr;
+
+	if (ospi_inst->transfer.addr_len == OSPI_ADDR_LENGTH_24_BITS) {
+		ospi_inst->rx_cmd[1] = (addr >> 16) & 0xFF;
+		ospi_inst->rx_cmd[2] = (addr >> 8) & 0xFF;
+		ospi_inst->rx_cmd[3] = addr & 0xFF;
+	} else {
+		ospi_inst->rx_cmd[1] = addr;
+	}
+}
+
+/* Helper : Start the next NDF sized chunk of a Receive only read */
+static void start_rx_chunk(struct hal_ospi_inst *ospi_inst)
+{
+	struct ospi_transfer *transfer = &ospi_inst->transfer;
+	uint32_t chunk;
+
+	chunk = ospi_inst->rx_pending;
+	if (chunk > SPI_CTRLR1_NDF_MAX)
+		chunk = SPI_CTRLR1_NDF_MAX;
+
+	ospi_inst->rx_pending -= chunk;
+
+	/* Only the command and address go through the Tx FIFO */
+	set_rx_cmd(ospi_inst);
+	set_tx_total_cnt(transfer);
+
+	transfer->tx_buff        = ospi_inst->rx_cmd;
+	transfer->tx_current_cnt = 0;
+	transfer->rx_total_cnt   = chunk;
+	transfer->rx_current_cnt = 0;
+	transfer->mode           = SPI_TMOD_RX;
+	transfer->status         = SPI_TRANSFER_STATUS_NONE;
+
+	ospi_receive((struct ospi_regs *) ospi_inst->regs, transfer);
+}
+
+/* Helper : Bytes per data frame of the prepared transfer */
+static uint32_t frame_bytes(struct hal_ospi_inst *ospi_inst)
+{
+	return (ospi_inst->transfer.dfs != 0 ? ospi_inst->transfer.dfs :
+		ospi_get_dfs((struct ospi_regs *) ospi_inst->regs)) / 8;
+}
+
+/* Helper : Account the start of a transfer */
+static inline void stats_start(struct hal_ospi_inst *ospi_inst, int num)
+{
+#ifdef CONFIG_ALIF_OSPI_STATS
+	ospi_inst->xfer_bytes = (uint32_t) num * frame_bytes(ospi_inst);
+	ospi_inst->xfer_irqs = 0;
+	ospi_inst->xfer_in_flight = 1;
+
+	if (ospi_inst->get_cycles != NULL)
+		ospi_inst->xfer_start = ospi_inst->get_cycles();
+#else
+	(void) ospi_inst;
+	(void) num;
+#endif
+}
+
+/* Helper : Account command/address frames sent ahead of the data */
+static inline void stats_cmd_frames(struct hal_ospi_inst *ospi_inst,
+				uint32_t frames)
+{
+#ifdef CONFIG_ALIF_OSPI_STATS
+	ospi_inst->xfer_bytes += frames * frame_bytes(ospi_inst);
+#else
+	(void) ospi_inst;
+	(void) frames;
+#endif
+}
+
+/* Helper : Account the completion of a transfer */
+static inline void stats_done(struct hal_ospi_inst *ospi_inst)
+{
+#ifdef CONFIG_ALIF_OSPI_STATS
+	struct ospi_stats *stats = &ospi_inst->stats;
+	uint32_t cycles, bin;
+
+	if (!ospi_inst->xfer_in_flight)
+		return;
+
+	ospi_inst->xfer_in_flight = 0;
+
+	stats->transfers++;
+	stats->bytes += ospi_inst->xfer_bytes;
+
+	if (ospi_inst->xfer_irqs > stats->max_irqs_per_xfer)
+		stats->max_irqs_per_xfer = ospi_inst->xfer_irqs;
+
+	if (ospi_inst->get_cycles == NULL)
+		return;
+
+	cycles = ospi_inst->get_cycles() - ospi_inst->xfer_start;
+
+	if (cycles < stats->lat_min || stats->lat_samples == 0)
+		stats->lat_min = cycles;
+	if (cycles > stats->lat_max)
+		stats->lat_max = cycles;
+	stats->lat_samples++;
+
+	/* Bin n holds [2^(n-1), 2^n) cycles, the last one the rest */
+	bin = (cycles == 0) ? 0 : 32 - __builtin_clz(cycles);
+	if (bin >= OSPI_STATS_HIST_BINS)
+		bin = OSPI_STATS_HIST_BINS - 1;
+
+	stats->lat_hist[bin]++;
+#else
+	(void) ospi_inst;
+#endif
+}
+
+/* Helper : Account an IRQ, and the error it carries */
+static inline void stats_irq(struct hal_ospi_inst *ospi_inst)
+{
+#ifdef CONFIG_ALIF_OSPI_STATS
+	ospi_inst->stats.irqs++;
+	ospi_inst->xfer_irqs++;
+
+	if (ospi_inst->transfer.status == SPI_TRANSFER_STATUS_OVERFLOW) {
+		ospi_inst->stats.overflows++;
+		ospi_inst->xfer_in_flight = 0;
+	} else if (ospi_inst->transfer.status ==
+				SPI_TRANSFER_STATUS_RX_UNDERFLOW) {
+		ospi_inst->stats.underflows++;
+		ospi_inst->xfer_in_flight = 0;
+	}
+#else
+	(void) ospi_inst;
+#endif
+}
+
+/* Helper : Account a XiP mode switch */
+static inline void stats_xip_switch(struct hal_ospi_inst *ospi_inst)
+{
+#ifdef CONFIG_ALIF_OSPI_STATS
+	ospi_inst->stats.xip_switches++;
+#else
+	(void) ospi_inst;
+#endif
+}
+
+/* Helper : Lock the descriptor queue against the IRQ handler */
+static inline uint32_t desc_queue_lock(void)
+{
+	uint32_t key = __get_PRIMASK();
+
+	__disable_irq();
+
+	return key;
+}
+
+/* Helper : Unlock the descriptor queue */
+static inline void desc_queue_unlock(uint32_t key)
+{
+	__set_PRIMASK(key);
+}
+
+/*
+ * Helper : Apply the transfer configuration to the instance. Nothing is
+ * written to the controller here, the frame size goes to CTRLR0 along
+ * with the next transfer's mode in a single disabled window.
+ */
+static void apply_trans_config(struct hal_ospi_inst *ospi_inst,
+				const struct ospi_trans_config *trans_conf)
+{
+	ospi_inst->transfer.dfs = trans_conf->frame_size;
+	ospi_inst->transfer.addr_len = trans_conf->addr_len;
+	ospi_inst->transfer.inst_len = trans_conf->inst_len;
+	ospi_inst->transfer.dummy_cycle = trans_conf->wait_cycles;
+	ospi_inst->transfer.spi_frf = trans_conf->frame_format;
+	ospi_inst->transfer.ddr = trans_conf->ddr_enable;
+	ospi_inst->transfer.ddr_inst_en = trans_conf->ddr_ins_enable;
+}
+
+/* Helper : Start a Send only transfer */
+static void start_send(struct hal_ospi_inst *ospi_inst, void *data, int num)
+{
+	stats_start(ospi_inst, num);
+
+	/* Update Transfer Settings */
+	ospi_inst->transfer.tx_total_cnt = num;
+	ospi_inst->transfer.mode = SPI_TMOD_TX;
+	ospi_inst->transfer.tx_buff = data;
+	ospi_inst->transfer.tx_current_cnt = 0;
+	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+	/* Send */
+	ospi_send((struct ospi_regs *)ospi_inst->regs, &(ospi_inst->transfer));
+}
+
+/* Helper : Start a Command/Address out, Data in transfer */
+static void start_transfer(struct hal_ospi_inst *ospi_inst,
+			void *data_out, void *data_in, int num)
+{
+	stats_start(ospi_inst, num);
+
+	ospi_inst->transfer.rx_total_cnt   = num;
+	ospi_inst->transfer.mode           = SPI_TMOD_TX_AND_RX;
+
+	/* Tx total count based on address length */
+	set_tx_total_cnt(&ospi_inst->transfer);
+	stats_cmd_frames(ospi_inst, ospi_inst->transfer.tx_total_cnt);
+
+	ospi_inst->transfer.tx_buff        = data_out;
+	ospi_inst->transfer.rx_buff        = data_in;
+	ospi_inst->transfer.tx_current_cnt = 0;
+	ospi_inst->transfer.rx_current_cnt = 0;
+	ospi_inst->transfer.status         = SPI_TRANSFER_STATUS_NONE;
+
+	ospi_transfer((struct ospi_regs *)ospi_inst->regs,
+			&(ospi_inst->transfer));
+}
+
+/* Helper : Start a Receive only read */
+static void start_receive(struct hal_ospi_inst *ospi_inst, uint32_t cmd,
+			uint32_t addr, void *data_in, int num)
+{
+	stats_start(ospi_inst, num);
+
+	ospi_inst->rx_cmd[0] = cmd;
+	ospi_inst->rx_addr = addr;
+	ospi_inst->rx_pending = num;
+	ospi_inst->rx_frame_bytes = frame_bytes(ospi_inst);
+
+	/* Command and address go out again for every NDF sized chunk */
+	set_tx_total_cnt(&ospi_inst->transfer);
+	stats_cmd_frames(ospi_inst, ospi_inst->transfer.tx_total_cnt *
+		(((uint32_t) num + SPI_CTRLR1_NDF_MAX - 1) / SPI_CTRLR1_NDF_MAX));
+
+	ospi_inst->transfer.rx_buff = data_in;
+
+	start_rx_chunk(ospi_inst);
+}
+
+/* Helper : Start the descriptor at the head of the queue */
+static void start_next_desc(struct hal_ospi_inst *ospi_inst)
+{
+	struct ospi_xfer_desc *desc;
+
+	desc = &ospi_inst->desc_queue[ospi_inst->desc_head];
+
+	ospi_inst->desc_head = (ospi_inst->desc_head + 1)
+				% HAL_OSPI_DESC_QUEUE_LEN;
+	ospi_inst->desc_count--;
+	ospi_inst->desc_active = 1;
+	ospi_inst->desc_notify = desc->notify;
+
+	if (desc->trans_conf != NULL)
+		apply_trans_config(ospi_inst, desc->trans_conf);
+
+	switch (desc->type) {
+	case OSPI_DESC_SEND:
+		start_send(ospi_inst, desc->data_out, desc->num);
+		break;
+	case OSPI_DESC_TRANSFER:
+		start_transfer(ospi_inst, desc->data_out, desc->data_in,
+				desc->num);
+		break;
+	case OSPI_DESC_RECEIVE:
+		start_receive(ospi_inst, desc->cmd, desc->addr, desc->data_in,
+				desc->num);
+		break;
+	}
+}
+
 /**
  * \fn          alif_hal_ospi_initialize
  * \brief       Get Instance and Initialized with given parameter
@@ -76,9 +423,32 @@ int32_t alif_hal_ospi_initialize(HAL_OSPI_Handle_T *handle,
 	if (init_d->rx_fifo_threshold > OSPI_RX_FIFO_DEPTH)
 		return OSPI_ERR_INVALID_PARAM;
 
+	if (init_d->xip_mbl > XIP_CTRL_XIP_MBL_16)
+		return OSPI_ERR_INVALID_PARAM;
+
+	if (init_d->tx_dma_level >= OSPI_TX_FIFO_DEPTH ||
+		init_d->rx_dma_level >= OSPI_RX_FIFO_DEPTH)
+		return OSPI_ERR_INVALID_PARAM;
+
 	/*Initialize the Handle*/
 	*handle = HAL_OSPI_INVALID_INST;
 
+#ifdef CONFIG_ALIF_OSPI_DT_INSTANCES
+	/*
+	 * The handle is fixed by devicetree: pick the node owning base_regs,
+	 * or the first free node when no base address is given.
+	 */
+	for (i = 0; i < HAL_OSPI_MAX_INST ; i++) {
+		if (!g_ospi_instance[i].is_avail)
+			continue;
+
+		if (init_d->base_regs == NULL ||
+			(uintptr_t) init_d->base_regs == ospi_dt_cfg[i].regs) {
+			*handle = i;
+			break;
+		}
+	}
+#else
 	/* Get the free instance */
 	for (i = 0; i < HAL_OSPI_MAX_INST ; i++) {
 		if (g_ospi_instance[i].is_avail) {
@@ -86,6 +456,7 @@ int32_t alif_hal_ospi_initialize(HAL_OSPI_Handle_T *handle,
 			break;
 		}
 	}
+#endif
 
 	if (i == HAL_OSPI_MAX_INST)
 		return OSPI_ERR_INVALID_HANDLE;
@@ -95,15 +466,38 @@ int32_t alif_hal_ospi_initialize(HAL_OSPI_Handle_T *handle,
 
 	ospi_inst->is_avail = 0;
 	ospi_inst->cs_pin = init_d->cs_pin;
+#ifdef CONFIG_ALIF_OSPI_DT_INSTANCES
+	ospi_inst->regs = (uint32_t *) ospi_dt_cfg[i].regs;
+	ospi_inst->aes_regs = (uint32_t *) ospi_dt_cfg[i].aes_regs;
+#else
 	ospi_inst->regs = init_d->base_regs;
+	ospi_inst->aes_regs = init_d->aes_regs;
+#endif
 	ospi_inst->bus_speed = init_d->bus_speed;
 	ospi_inst->core_clk  = init_d->core_clk;
 	ospi_inst->ddr_drive_edge = init_d->ddr_drive_edge;
 	ospi_inst->rx_fifo_threshold = init_d->rx_fifo_threshold;
 	ospi_inst->tx_fifo_threshold = init_d->tx_fifo_threshold;
+	ospi_inst->tx_dma_level = init_d->tx_dma_level;
+	ospi_inst->rx_dma_level = init_d->rx_dma_level;
 	ospi_inst->event_cb = init_d->event_cb;
 	ospi_inst->user_data = init_d->user_data;
-	ospi_inst->aes_regs = init_d->aes_regs;
+#ifdef CONFIG_ALIF_OSPI_STATS
+	ospi_inst->get_cycles = init_d->get_cycles;
+#endif
+
+	ospi_inst->rx_pending = 0;
+	ospi_inst->xip_suspend_cnt = 0;
+
+#ifdef CONFIG_ALIF_OSPI_STATS
+	memset(&ospi_inst->stats, 0, sizeof(struct ospi_stats));
+	ospi_inst->xfer_in_flight = 0;
+#endif
+
+	/* Clear Descriptor Queue */
+	ospi_inst->desc_head = 0;
+	ospi_inst->desc_count = 0;
+	ospi_inst->desc_active = 0;
 
 	/* Clear Transfer Object */
 	memset(&ospi_inst->transfer, 0, sizeof(struct ospi_transfer));
@@ -116,17 +510,22 @@ int32_t alif_hal_ospi_initialize(HAL_OSPI_Handle_T *handle,
 	ospi_inst->xip_config.incr_cmd = init_d->xip_incr_cmd;
 	ospi_inst->xip_config.xip_cs_pin = init_d->cs_pin;
 	ospi_inst->xip_config.xip_cnt_time_out = init_d->xip_cnt_time_out;
+	ospi_inst->xip_config.rx_smpl_dlay = init_d->rx_sample_delay;
 	ospi_inst->xip_config.aes_rx_ds_dlay = init_d->rx_ds_delay;
 	ospi_inst->xip_config.xip_rxds_vl_en = init_d->xip_rxds_vl_en;
 	ospi_inst->xip_config.xip_wait_cycles = init_d->xip_wait_cycles;
+	ospi_inst->xip_config.xip_prefetch_en = init_d->xip_prefetch_en;
+	ospi_inst->xip_config.xip_cont_xfer_en = init_d->xip_cont_xfer_en;
+	ospi_inst->xip_config.xip_mbl = init_d->xip_mbl;
 
-	ospi_regs = (struct ospi_regs *) init_d->base_regs;
+	ospi_regs = (struct ospi_regs *) ospi_inst->regs;
 
 	ospi_set_tx_threshold(ospi_regs, init_d->tx_fifo_threshold);
 
 	ospi_set_rx_threshold(ospi_regs, init_d->rx_fifo_threshold);
 
 	ospi_set_rx_sample_delay(ospi_regs, init_d->rx_sample_delay);
+	ospi_inst->rx_sample_delay = init_d->rx_sample_delay;
 
 	ospi_set_ddr_drive_edge(ospi_regs, init_d->ddr_drive_edge);
 
@@ -136,7 +535,7 @@ int32_t alif_hal_ospi_initialize(HAL_OSPI_Handle_T *handle,
 
 	ospi_set_bus_speed(ospi_regs, init_d->bus_speed, init_d->core_clk);
 
-	aes_regs = (struct ospi_aes_regs *) init_d->aes_regs;
+	aes_regs = (struct ospi_aes_regs *) ospi_inst->aes_regs;
 
 	aes_regs->AES_RXDS_DLY = init_d->rx_ds_delay;
 
@@ -174,6 +573,10 @@ int32_t alif_hal_ospi_deinit(HAL_OSPI_Handle_T handle)
 	if (ospi_inst == NULL)
 		return OSPI_ERR_INVALID_HANDLE;
 
+	/* Only a claimed instance is released, never a disabled node */
+	if (ospi_inst->is_avail || ospi_inst->regs == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
 	ospi_inst->is_avail = 1;
 
 	/* Clear rest. */
@@ -184,6 +587,21 @@ int32_t alif_hal_ospi_deinit(HAL_OSPI_Handle_T handle)
 	ospi_inst->ddr_drive_edge = 0;
 	ospi_inst->rx_fifo_threshold = 0;
 	ospi_inst->tx_fifo_threshold = 0;
+	ospi_inst->tx_dma_level = 0;
+	ospi_inst->rx_dma_level = 0;
+
+	ospi_inst->rx_pending = 0;
+	ospi_inst->xip_suspend_cnt = 0;
+
+#ifdef CONFIG_ALIF_OSPI_STATS
+	memset(&ospi_inst->stats, 0, sizeof(struct ospi_stats));
+	ospi_inst->xfer_in_flight = 0;
+#endif
+
+	/* Clear Descriptor Queue */
+	ospi_inst->desc_head = 0;
+	ospi_inst->desc_count = 0;
+	ospi_inst->desc_active = 0;
 
 	/* Clear Transfer Object */
 	memset(&ospi_inst->transfer, 0, sizeof(struct ospi_transfer));
@@ -205,7 +623,6 @@ int32_t alif_hal_ospi_prepare_transfer(HAL_OSPI_Handle_T handle,
 				struct ospi_trans_config *trans_conf)
 {
 	struct hal_ospi_inst *ospi_inst;
-	struct ospi_regs *ospi_regs;
 
 	ospi_inst = get_inst_by_handle(handle);
 
@@ -215,16 +632,11 @@ int32_t alif_hal_ospi_prepare_transfer(HAL_OSPI_Handle_T handle,
 	if (ospi_inst == NULL)
 		return OSPI_ERR_INVALID_HANDLE;
 
-	ospi_regs = (struct ospi_regs *) ospi_inst->regs;
-
-	ospi_set_dfs(ospi_regs, trans_conf->frame_size);
+	/* Queued descriptors carry their own configuration */
+	if (ospi_inst->desc_active)
+		return OSPI_ERR_CTRL_BUSY;
 
-	ospi_inst->transfer.addr_len = trans_conf->addr_len;
-	ospi_inst->transfer.inst_len = trans_conf->inst_len;
-	ospi_inst->transfer.dummy_cycle = trans_conf->wait_cycles;
-	ospi_inst->transfer.spi_frf = trans_conf->frame_format;
-	ospi_inst->transfer.ddr = trans_conf->ddr_enable;
-	ospi_inst->transfer.ddr_inst_en = trans_conf->ddr_ins_enable;
+	apply_trans_config(ospi_inst, trans_conf);
 
 	return  OSPI_ERR_NONE;
 }
@@ -272,18 +684,11 @@ int32_t alif_hal_ospi_send(HAL_OSPI_Handle_T handle, void *data, int num)
 	if (num <= 0)
 		return OSPI_ERR_INVALID_PARAM;
 
-	if (ospi_busy((struct ospi_regs *) ospi_inst->regs))
+	if (ospi_inst->desc_active ||
+		ospi_busy((struct ospi_regs *) ospi_inst->regs))
 		return OSPI_ERR_CTRL_BUSY;
 
-	/* Update Transfer Settings */
-	ospi_inst->transfer.tx_total_cnt = num;
-	ospi_inst->transfer.mode = SPI_TMOD_TX;
-	ospi_inst->transfer.tx_buff = data;
-	ospi_inst->transfer.tx_current_cnt = 0;
-	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
-
-	/* Send */
-	ospi_send((struct ospi_regs *)ospi_inst->regs, &(ospi_inst->transfer));
+	start_send(ospi_inst, data, num);
 
 	return OSPI_ERR_NONE;
 }
@@ -306,95 +711,68 @@ int32_t alif_hal_ospi_transfer(HAL_OSPI_Handle_T handle,
 	if (ospi_inst == NULL)
 		return OSPI_ERR_INVALID_HANDLE;
 
-	if (ospi_busy((struct ospi_regs *) ospi_inst->regs))
+	if (ospi_inst->desc_active ||
+		ospi_busy((struct ospi_regs *) ospi_inst->regs))
 		return OSPI_ERR_CTRL_BUSY;
 
-	ospi_inst->transfer.rx_total_cnt   = num;
-	ospi_inst->transfer.mode           = SPI_TMOD_TX_AND_RX;
-
-	/* Tx total count based on address length */
-	if (ospi_inst->transfer.addr_len == OSPI_ADDR_LENGTH_0_BITS)
-		ospi_inst->transfer.tx_total_cnt = 1;
-	else if (ospi_inst->transfer.addr_len == OSPI_ADDR_LENGTH_24_BITS)
-		ospi_inst->transfer.tx_total_cnt = 4;
-	else if (ospi_inst->transfer.addr_len == OSPI_ADDR_LENGTH_32_BITS)
-		ospi_inst->transfer.tx_total_cnt = 2;
-
-	ospi_inst->transfer.tx_buff        = data_out;
-	ospi_inst->transfer.rx_buff        = data_in;
-	ospi_inst->transfer.tx_current_cnt = 0;
-	ospi_inst->transfer.rx_current_cnt = 0;
-	ospi_inst->transfer.status         = SPI_TRANSFER_STATUS_NONE;
-
-	ospi_transfer((struct ospi_regs *)ospi_inst->regs,
-			&(ospi_inst->transfer));
+	start_transfer(ospi_inst, data_out, data_in, num);
 
 	return OSPI_ERR_NONE;
 }
 
 /**
- * \fn          alif_hal_ospi_irq_handler
- * \brief       Interrupt Handler for OSPI interface.
+ * \fn          alif_hal_ospi_dma_send
+ * \brief       Transfer the data, with the Tx FIFO fed by DMA.
  * \param[in]   handle  Instance handler
- * \param[out]  event_status  Status of transreceive status
+ * \param[in]   data_out  Transmit data buffer
+ * \param[in]   num  length of the buffer
  * \return      0 on Success, else error code.
  */
-int32_t alif_hal_ospi_irq_handler(HAL_OSPI_Handle_T handle)
+int32_t alif_hal_ospi_dma_send(HAL_OSPI_Handle_T handle, void *data, int num)
 {
 	struct hal_ospi_inst *ospi_inst;
+	struct ospi_regs *ospi_regs;
 
 	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
 
-	struct ospi_regs *ospi_reg = (struct ospi_regs *) ospi_inst->regs;
-
-	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
-
-	ospi_irq_handler(ospi_reg, &ospi_inst->transfer);
+	if (num <= 0)
+		return OSPI_ERR_INVALID_PARAM;
 
-	if (ospi_inst->transfer.status == SPI_TRANSFER_STATUS_COMPLETE) {
+	ospi_regs = (struct ospi_regs *) ospi_inst->regs;
 
-		ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+	if (ospi_inst->desc_active || ospi_busy(ospi_regs))
+		return OSPI_ERR_CTRL_BUSY;
 
-		/* update event Status */
-		ospi_inst->event_cb(OSPI_EVENT_TRANSFER_COMPLETE,
-						ospi_inst->user_data);
-	}
+	/* Update Transfer Settings */
+	ospi_inst->transfer.tx_total_cnt = num;
+	ospi_inst->transfer.mode = SPI_TMOD_TX;
+	ospi_inst->transfer.tx_buff = data;
+	ospi_inst->transfer.tx_current_cnt = 0;
+	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
 
-	if (ospi_inst->transfer.status == SPI_TRANSFER_STATUS_OVERFLOW ||
-		ospi_inst->transfer.status == SPI_TRANSFER_STATUS_RX_UNDERFLOW) {
+	ospi_set_tx_dma_data_level(ospi_regs, ospi_inst->tx_dma_level);
 
-		ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+	stats_start(ospi_inst, num);
 
-		/* update event Status */
-		ospi_inst->event_cb(OSPI_EVENT_DATA_LOST, ospi_inst->user_data);
-	}
+	/* Send, Tx FIFO is filled by the DMA requests */
+	ospi_dma_send(ospi_regs, &(ospi_inst->transfer));
 
 	return OSPI_ERR_NONE;
 }
 
 /**
- * \fn          alif_hal_ospi_receive
- * \brief       Send and Receive data
+ * \fn          alif_hal_ospi_hyperbus_send
+ * \brief       Hyperbus write, interrupt driven. Completion is reported
+ *              through OSPI_EVENT_TRANSFER_COMPLETE.
  * \param[in]   handle  Instance handler
- * \param[in]   data_out  Receive data buffer
- * \param[in]   num  length of the buffer to receive
- * \return      0 on Success, else error code.
- */
-int32_t alif_hal_ospi_receive(HAL_OSPI_Handle_T handle,
-				void *data_out, int num)
-{
-	/*TODO*/
-	return OSPI_ERR_NONE;
-}
-
-
-/**
- * \fn          alif_hal_ospi_xip_enable
- * \brief       Enable XiP.
- * \param[in]   handle  Instance handlerd
+ * \param[in]   data  Command/Address frames followed by the data
+ * \param[in]   num  length of the buffer
  * \return      0 on Success, else error code.
  */
-int32_t alif_hal_ospi_xip_enable(HAL_OSPI_Handle_T handle)
+int32_t alif_hal_ospi_hyperbus_send(HAL_OSPI_Handle_T handle, void *data,
+				int num)
 {
 	struct hal_ospi_inst *ospi_inst;
 
@@ -402,36 +780,475 @@ int32_t alif_hal_ospi_xip_enable(HAL_OSPI_Handle_T handle)
 	if (ospi_inst == NULL)
 		return OSPI_ERR_INVALID_HANDLE;
 
-	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
-			ospi_inst->cs_pin, SPI_SS_STATE_DISABLE);
+	if (data == NULL || num <= 0)
+		return OSPI_ERR_INVALID_PARAM;
 
-	ospi_xip_enable((struct ospi_regs *) ospi_inst->regs,
-			(struct ospi_aes_regs *) ospi_inst->aes_regs,
-			&ospi_inst->xip_config);
+	if (ospi_inst->desc_active ||
+		ospi_busy((struct ospi_regs *) ospi_inst->regs))
+		return OSPI_ERR_CTRL_BUSY;
 
-	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
-			ospi_inst->cs_pin, SPI_SS_STATE_ENABLE);
+	ospi_inst->transfer.tx_total_cnt = num;
+	ospi_inst->transfer.tx_buff = data;
+	ospi_inst->transfer.tx_current_cnt = 0;
+	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+	stats_start(ospi_inst, num);
+
+	ospi_hyperbus_send_async((struct ospi_regs *) ospi_inst->regs,
+				&(ospi_inst->transfer));
 
 	return OSPI_ERR_NONE;
 }
 
 /**
- * \fn          alif_hal_ospi_xip_disable
- * \brief       Disable XiP.
- * \param[in]   handle  Instance handlerd
+ * \fn          alif_hal_ospi_hyperbus_dma_send
+ * \brief       Hyperbus write, Tx FIFO fed by DMA. Call
+ *              alif_hal_ospi_dma_complete from the DMA completion.
+ * \param[in]   handle  Instance handler
+ * \param[in]   data  Command/Address frames followed by the data
+ * \param[in]   num  length of the buffer
  * \return      0 on Success, else error code.
  */
-int32_t alif_hal_ospi_xip_disable(HAL_OSPI_Handle_T handle)
+int32_t alif_hal_ospi_hyperbus_dma_send(HAL_OSPI_Handle_T handle, void *data,
+				int num)
 {
 	struct hal_ospi_inst *ospi_inst;
+	struct ospi_regs *ospi_regs;
 
 	ospi_inst = get_inst_by_handle(handle);
 	if (ospi_inst == NULL)
 		return OSPI_ERR_INVALID_HANDLE;
 
-	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
-			ospi_inst->cs_pin, SPI_SS_STATE_DISABLE);
+	if (num <= 0)
+		return OSPI_ERR_INVALID_PARAM;
 
+	ospi_regs = (struct ospi_regs *) ospi_inst->regs;
+
+	if (ospi_inst->desc_active || ospi_busy(ospi_regs))
+		return OSPI_ERR_CTRL_BUSY;
+
+	ospi_inst->transfer.tx_total_cnt = num;
+	ospi_inst->transfer.tx_buff = data;
+	ospi_inst->transfer.tx_current_cnt = 0;
+	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+	ospi_set_tx_dma_data_level(ospi_regs, ospi_inst->tx_dma_level);
+
+	stats_start(ospi_inst, num);
+
+	ospi_hyperbus_dma_send(ospi_regs, &(ospi_inst->transfer));
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_dma_transfer
+ * \brief       Send command/address and Receive data through DMA.
+ * \param[in]   handle  Instance handler
+ * \param[in]   data_out  Transmit data buffer
+ * \param[in]   data_in  Receive data buffer
+ * \param[in]   num  length of the buffer
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_dma_transfer(HAL_OSPI_Handle_T handle,
+			void *data_out, void *data_in, int num)
+{
+	struct hal_ospi_inst *ospi_inst;
+	struct ospi_regs *ospi_regs;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (num <= 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	ospi_regs = (struct ospi_regs *) ospi_inst->regs;
+
+	if (ospi_inst->desc_active || ospi_busy(ospi_regs))
+		return OSPI_ERR_CTRL_BUSY;
+
+	ospi_inst->transfer.rx_total_cnt   = num;
+	ospi_inst->transfer.mode           = SPI_TMOD_TX_AND_RX;
+
+	/* Tx total count based on address length */
+	set_tx_total_cnt(&ospi_inst->transfer);
+
+	ospi_inst->transfer.tx_buff        = data_out;
+	ospi_inst->transfer.rx_buff        = data_in;
+	ospi_inst->transfer.tx_current_cnt = 0;
+	ospi_inst->transfer.rx_current_cnt = 0;
+	ospi_inst->transfer.status         = SPI_TRANSFER_STATUS_NONE;
+
+	ospi_set_tx_dma_data_level(ospi_regs, ospi_inst->tx_dma_level);
+	ospi_set_rx_dma_data_level(ospi_regs, ospi_inst->rx_dma_level);
+
+	stats_start(ospi_inst, num);
+	stats_cmd_frames(ospi_inst, ospi_inst->transfer.tx_total_cnt);
+
+	ospi_dma_transfer(ospi_regs, &(ospi_inst->transfer));
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_dma_complete
+ * \brief       Finish a DMA send/transfer.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_dma_complete(HAL_OSPI_Handle_T handle)
+{
+	struct hal_ospi_inst *ospi_inst;
+	struct ospi_regs *ospi_regs;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	ospi_regs = (struct ospi_regs *) ospi_inst->regs;
+
+	ospi_disable_tx_dma(ospi_regs);
+	ospi_disable_rx_dma(ospi_regs);
+
+	if (ospi_inst->transfer.mode == SPI_TMOD_TX) {
+		/*
+		 * All the data is in the Tx FIFO, but not yet on the bus.
+		 * Let the Tx FIFO empty interrupt report the completion.
+		 */
+		ospi_inst->transfer.tx_current_cnt =
+					ospi_inst->transfer.tx_total_cnt;
+		ospi_regs->OSPI_IMR |= SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK;
+
+		return OSPI_ERR_NONE;
+	}
+
+	/* Receive is done once the last frame has been moved */
+	ospi_mask_interrupts(ospi_regs);
+	ospi_disable(ospi_regs);
+
+	ospi_inst->transfer.tx_current_cnt = 0;
+	ospi_inst->transfer.rx_current_cnt = 0;
+	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+	stats_done(ospi_inst);
+
+	ospi_inst->event_cb(OSPI_EVENT_TRANSFER_COMPLETE,
+					ospi_inst->user_data);
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_get_dma_addr
+ * \brief       Get the Data(FIFO) register address for DMA.
+ * \param[in]   handle  Instance handler
+ * \param[out]  addr  Data register address
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_get_dma_addr(HAL_OSPI_Handle_T handle,
+			volatile uint32_t **addr)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (addr == NULL)
+		return OSPI_ERR_INVALID_PARAM;
+
+	*addr = ospi_get_dma_addr((struct ospi_regs *) ospi_inst->regs);
+
+	return OSPI_ERR_NONE;
+}
+
+/*
+ * Helper : Interrupt handling of an instance. Inlined into the handle
+ * based handler and into the per-node ones, where the instance and the
+ * register block are constants.
+ */
+static inline void irq_handler(struct hal_ospi_inst *ospi_inst,
+				struct ospi_regs *ospi_reg)
+{
+	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+	ospi_irq_handler(ospi_reg, &ospi_inst->transfer);
+
+	stats_irq(ospi_inst);
+
+	if (ospi_inst->transfer.status == SPI_TRANSFER_STATUS_COMPLETE &&
+		ospi_inst->transfer.mode == SPI_TMOD_RX &&
+		ospi_inst->rx_pending != 0) {
+
+		/* Continue the read right after the chunk just received */
+		ospi_inst->rx_addr += ospi_inst->transfer.rx_total_cnt
+					* ospi_inst->rx_frame_bytes;
+
+		start_rx_chunk(ospi_inst);
+	}
+
+	if (ospi_inst->transfer.status == SPI_TRANSFER_STATUS_COMPLETE &&
+		ospi_inst->desc_active) {
+
+		ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+		stats_done(ospi_inst);
+
+		if (ospi_inst->desc_notify)
+			ospi_inst->event_cb(OSPI_EVENT_DESC_COMPLETE,
+						ospi_inst->user_data);
+
+		/* Chain the next descriptor without leaving the IRQ */
+		if (ospi_inst->desc_count != 0) {
+			start_next_desc(ospi_inst);
+		} else {
+			ospi_inst->desc_active = 0;
+			ospi_inst->transfer.status =
+					SPI_TRANSFER_STATUS_COMPLETE;
+		}
+	}
+
+	if (ospi_inst->transfer.status == SPI_TRANSFER_STATUS_COMPLETE) {
+
+		ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+		stats_done(ospi_inst);
+
+		/* update event Status */
+		ospi_inst->event_cb(OSPI_EVENT_TRANSFER_COMPLETE,
+						ospi_inst->user_data);
+	}
+
+	if (ospi_inst->transfer.status == SPI_TRANSFER_STATUS_OVERFLOW ||
+		ospi_inst->transfer.status == SPI_TRANSFER_STATUS_RX_UNDERFLOW) {
+
+		ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+
+		/* Drop the rest of a chunked read and of the queue */
+		ospi_inst->rx_pending = 0;
+		ospi_inst->desc_count = 0;
+		ospi_inst->desc_active = 0;
+
+		/* update event Status */
+		ospi_inst->event_cb(OSPI_EVENT_DATA_LOST, ospi_inst->user_data);
+	}
+}
+
+/**
+ * \fn          alif_hal_ospi_irq_handler
+ * \brief       Interrupt Handler for OSPI interface.
+ * \param[in]   handle  Instance handler
+ * \param[out]  event_status  Status of transreceive status
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_irq_handler(HAL_OSPI_Handle_T handle)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+
+	irq_handler(ospi_inst, (struct ospi_regs *) ospi_inst->regs);
+
+	return OSPI_ERR_NONE;
+}
+
+#ifdef CONFIG_ALIF_OSPI_DT_INSTANCES
+#if OSPI_DT_OKAY(0)
+/**
+ * \fn          alif_hal_ospi0_irq_handler
+ * \brief       Interrupt Handler for the ospi0 node, no handle lookup.
+ * \return      none
+ */
+void alif_hal_ospi0_irq_handler(void)
+{
+	irq_handler(&g_ospi_instance[0],
+			(struct ospi_regs *) ospi_dt_cfg[0].regs);
+}
+#endif
+
+#if OSPI_DT_OKAY(1)
+/**
+ * \fn          alif_hal_ospi1_irq_handler
+ * \brief       Interrupt Handler for the ospi1 node, no handle lookup.
+ * \return      none
+ */
+void alif_hal_ospi1_irq_handler(void)
+{
+	irq_handler(&g_ospi_instance[1],
+			(struct ospi_regs *) ospi_dt_cfg[1].regs);
+}
+#endif
+#endif
+
+/**
+ * \fn          alif_hal_ospi_receive
+ * \brief       Receive data in Receive only mode
+ * \param[in]   handle  Instance handler
+ * \param[in]   cmd  Command (instruction) frame
+ * \param[in]   addr  Start address
+ * \param[in]   data_in  Receive data buffer
+ * \param[in]   num  Number of frames to receive
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_receive(HAL_OSPI_Handle_T handle, uint32_t cmd,
+				uint32_t addr, void *data_in, int num)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (data_in == NULL || num <= 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	if (ospi_inst->desc_active ||
+		ospi_busy((struct ospi_regs *) ospi_inst->regs))
+		return OSPI_ERR_CTRL_BUSY;
+
+	start_receive(ospi_inst, cmd, addr, data_in, num);
+
+	return OSPI_ERR_NONE;
+}
+
+
+/* Helper : Check a descriptor before it goes into the queue */
+static bool desc_valid(const struct ospi_xfer_desc *desc)
+{
+	if (desc->num <= 0 || desc->type > OSPI_DESC_RECEIVE)
+		return false;
+
+	if ((desc->type != OSPI_DESC_RECEIVE && desc->data_out == NULL) ||
+		(desc->type != OSPI_DESC_SEND && desc->data_in == NULL))
+		return false;
+
+	return true;
+}
+
+/**
+ * \fn          alif_hal_ospi_queue_chain
+ * \brief       Queue descriptors as one unit, none of them starts before
+ *              all are queued.
+ * \param[in]   handle  Instance handler
+ * \param[in]   desc  Transfer descriptors, copied into the queue
+ * \param[in]   num  Number of descriptors
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_queue_chain(HAL_OSPI_Handle_T handle,
+				const struct ospi_xfer_desc *desc, uint32_t num)
+{
+	struct hal_ospi_inst *ospi_inst;
+	uint32_t key, index;
+	int32_t ret = OSPI_ERR_NONE;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (desc == NULL || num == 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	for (index = 0; index < num; index++) {
+		if (!desc_valid(&desc[index]))
+			return OSPI_ERR_INVALID_PARAM;
+	}
+
+	key = desc_queue_lock();
+
+	if (num > (uint32_t) (HAL_OSPI_DESC_QUEUE_LEN
+				- ospi_inst->desc_count)) {
+		ret = OSPI_ERR_QUEUE_FULL;
+	} else if (!ospi_inst->desc_active &&
+		ospi_busy((struct ospi_regs *) ospi_inst->regs)) {
+		/* A direct transfer still runs */
+		ret = OSPI_ERR_CTRL_BUSY;
+	} else {
+		for (index = 0; index < num; index++) {
+			ospi_inst->desc_queue[(ospi_inst->desc_head
+					+ ospi_inst->desc_count)
+					% HAL_OSPI_DESC_QUEUE_LEN] = desc[index];
+			ospi_inst->desc_count++;
+		}
+
+		if (!ospi_inst->desc_active)
+			start_next_desc(ospi_inst);
+	}
+
+	desc_queue_unlock(key);
+
+	return ret;
+}
+
+/**
+ * \fn          alif_hal_ospi_queue_transfer
+ * \brief       Queue a transfer descriptor, started right away when the
+ *              queue is idle, else from the IRQ handler.
+ * \param[in]   handle  Instance handler
+ * \param[in]   desc  Transfer descriptor, copied into the queue
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_queue_transfer(HAL_OSPI_Handle_T handle,
+				const struct ospi_xfer_desc *desc)
+{
+	return alif_hal_ospi_queue_chain(handle, desc, 1);
+}
+
+/**
+ * \fn          alif_hal_ospi_xip_enable
+ * \brief       Enable XiP.
+ * \param[in]   handle  Instance handlerd
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_enable(HAL_OSPI_Handle_T handle)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	/* Resumed by the last alif_hal_ospi_xip_resume */
+	if (ospi_inst->xip_suspend_cnt != 0)
+		return OSPI_ERR_CTRL_BUSY;
+
+	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
+			ospi_inst->cs_pin, SPI_SS_STATE_DISABLE);
+
+	stats_xip_switch(ospi_inst);
+
+	ospi_xip_enable((struct ospi_regs *) ospi_inst->regs,
+			(struct ospi_aes_regs *) ospi_inst->aes_regs,
+			&ospi_inst->xip_config);
+
+	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
+			ospi_inst->cs_pin, SPI_SS_STATE_ENABLE);
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_xip_disable
+ * \brief       Disable XiP.
+ * \param[in]   handle  Instance handlerd
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_disable(HAL_OSPI_Handle_T handle)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (ospi_inst->xip_suspend_cnt != 0)
+		return OSPI_ERR_CTRL_BUSY;
+
+	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
+			ospi_inst->cs_pin, SPI_SS_STATE_DISABLE);
+
+
+	stats_xip_switch(ospi_inst);
 
 	ospi_xip_disable((struct ospi_regs *) ospi_inst->regs,
 			(struct ospi_aes_regs *) ospi_inst->aes_regs,
@@ -442,3 +1259,287 @@ int32_t alif_hal_ospi_xip_disable(HAL_OSPI_Handle_T handle)
 
 	return OSPI_ERR_NONE;
 }
+
+/**
+ * \fn          alif_hal_ospi_xip_suspend
+ * \brief       Suspend XiP for command mode access. Calls nest, only the
+ *              outermost one switches the controller.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_suspend(HAL_OSPI_Handle_T handle)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (ospi_inst->xip_suspend_cnt == UINT8_MAX)
+		return OSPI_ERR_CTRL_BUSY;
+
+	if (ospi_inst->xip_suspend_cnt++ != 0)
+		return OSPI_ERR_NONE;
+
+	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
+			ospi_inst->cs_pin, SPI_SS_STATE_DISABLE);
+
+	stats_xip_switch(ospi_inst);
+
+	ospi_xip_disable((struct ospi_regs *) ospi_inst->regs,
+			(struct ospi_aes_regs *) ospi_inst->aes_regs,
+			&ospi_inst->transfer, &ospi_inst->xip_config);
+
+	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
+			ospi_inst->cs_pin, SPI_SS_STATE_ENABLE);
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_xip_resume
+ * \brief       Resume XiP once the last suspend is released.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_resume(HAL_OSPI_Handle_T handle)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (ospi_inst->xip_suspend_cnt == 0)
+		return OSPI_ERR_INVALID_STATE;
+
+	if (--ospi_inst->xip_suspend_cnt != 0)
+		return OSPI_ERR_NONE;
+
+	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
+			ospi_inst->cs_pin, SPI_SS_STATE_DISABLE);
+
+	stats_xip_switch(ospi_inst);
+
+	ospi_xip_enable((struct ospi_regs *) ospi_inst->regs,
+			(struct ospi_aes_regs *) ospi_inst->aes_regs,
+			&ospi_inst->xip_config);
+
+	ospi_control_ss((struct ospi_regs *) ospi_inst->regs,
+			ospi_inst->cs_pin, SPI_SS_STATE_ENABLE);
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_xip_write_burst
+ * \brief       Run a batch of program operations under one XiP
+ *              suspend/resume.
+ * \param[in]   handle  Instance handler
+ * \param[in,out] burst  Operations in, progress and timing out
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_xip_write_burst(HAL_OSPI_Handle_T handle,
+				struct ospi_write_burst *burst)
+{
+	uint32_t start = 0;
+	int32_t ret, status;
+
+	if (burst == NULL || burst->program == NULL ||
+		(burst->ops == NULL && burst->num_ops != 0))
+		return OSPI_ERR_INVALID_PARAM;
+
+	burst->done = 0;
+	burst->xip_off_cycles = 0;
+
+	if (burst->get_cycles != NULL)
+		start = burst->get_cycles();
+
+	ret = alif_hal_ospi_xip_suspend(handle);
+	if (ret != OSPI_ERR_NONE)
+		return ret;
+
+	while (burst->done < burst->num_ops) {
+		ret = burst->program(handle, &burst->ops[burst->done],
+					burst->ctx);
+		if (ret != OSPI_ERR_NONE)
+			break;
+
+		burst->done++;
+	}
+
+	status = alif_hal_ospi_xip_resume(handle);
+	if (ret == OSPI_ERR_NONE)
+		ret = status;
+
+	if (burst->get_cycles != NULL)
+		burst->xip_off_cycles = burst->get_cycles() - start;
+
+	return ret;
+}
+
+/**
+ * \fn          alif_hal_ospi_set_rx_delays
+ * \brief       Update the Rx sample delay and the Rx-DS delay. The
+ *              sample delay is also kept for the next XiP enable.
+ * \param[in]   handle  Instance handler
+ * \param[in]   rx_sample_delay  Rx Sample Delay
+ * \param[in]   rx_ds_delay  Rx-DS Delay
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_set_rx_delays(HAL_OSPI_Handle_T handle,
+				uint8_t rx_sample_delay, uint8_t rx_ds_delay)
+{
+	struct hal_ospi_inst *ospi_inst;
+	struct ospi_aes_regs *aes_regs;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (ospi_inst->desc_active ||
+		ospi_busy((struct ospi_regs *) ospi_inst->regs))
+		return OSPI_ERR_CTRL_BUSY;
+
+	aes_regs = (struct ospi_aes_regs *) ospi_inst->aes_regs;
+
+	ospi_set_rx_sample_delay((struct ospi_regs *) ospi_inst->regs,
+				rx_sample_delay);
+
+	aes_regs->AES_RXDS_DLY = rx_ds_delay;
+
+	/* ospi_xip_enable() reloads the sample delay from the XiP config */
+	ospi_inst->rx_sample_delay = rx_sample_delay;
+	ospi_inst->xip_config.rx_smpl_dlay = rx_sample_delay;
+	ospi_inst->xip_config.aes_rx_ds_dlay = rx_ds_delay;
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_save_context
+ * \brief       Snapshot the controller and AES/XiP registers.
+ * \param[in]   handle  Instance handler
+ * \param[out]  ctx  Snapshot
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_save_context(HAL_OSPI_Handle_T handle,
+				struct ospi_context *ctx)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (ctx == NULL)
+		return OSPI_ERR_INVALID_PARAM;
+
+	if (ospi_inst->desc_active ||
+		ospi_busy((struct ospi_regs *) ospi_inst->regs))
+		return OSPI_ERR_CTRL_BUSY;
+
+	ospi_save_context((struct ospi_regs *) ospi_inst->regs,
+			(struct ospi_aes_regs *) ospi_inst->aes_regs, ctx);
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_restore_context
+ * \brief       Re-apply a snapshot after wake-up.
+ * \param[in]   handle  Instance handler
+ * \param[in]   ctx  Snapshot
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_restore_context(HAL_OSPI_Handle_T handle,
+				const struct ospi_context *ctx)
+{
+	struct hal_ospi_inst *ospi_inst;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (ctx == NULL || ctx->magic != OSPI_CONTEXT_MAGIC)
+		return OSPI_ERR_INVALID_PARAM;
+
+	ospi_restore_context((struct ospi_regs *) ospi_inst->regs,
+			(struct ospi_aes_regs *) ospi_inst->aes_regs, ctx);
+
+	/* Nothing in flight survives the power down */
+	ospi_inst->rx_pending = 0;
+	ospi_inst->desc_head = 0;
+	ospi_inst->desc_count = 0;
+	ospi_inst->desc_active = 0;
+	ospi_inst->xip_suspend_cnt = 0;
+	ospi_inst->transfer.status = SPI_TRANSFER_STATUS_NONE;
+#ifdef CONFIG_ALIF_OSPI_STATS
+	ospi_inst->xfer_in_flight = 0;
+#endif
+
+	return OSPI_ERR_NONE;
+}
+
+/**
+ * \fn          alif_hal_ospi_get_stats
+ * \brief       Copy the statistics of the instance.
+ * \param[in]   handle  Instance handler
+ * \param[out]  stats  Statistics
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_get_stats(HAL_OSPI_Handle_T handle,
+				struct ospi_stats *stats)
+{
+#ifdef CONFIG_ALIF_OSPI_STATS
+	struct hal_ospi_inst *ospi_inst;
+	uint32_t key;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	if (stats == NULL)
+		return OSPI_ERR_INVALID_PARAM;
+
+	/* Consistent snapshot against the IRQ handler */
+	key = desc_queue_lock();
+	*stats = ospi_inst->stats;
+	desc_queue_unlock(key);
+
+	return OSPI_ERR_NONE;
+#else
+	(void) handle;
+	(void) stats;
+
+	return OSPI_ERR_INVALID_STATE;
+#endif
+}
+
+/**
+ * \fn          alif_hal_ospi_reset_stats
+ * \brief       Clear the statistics of the instance.
+ * \param[in]   handle  Instance handler
+ * \return      0 on Success, else error code.
+ */
+int32_t alif_hal_ospi_reset_stats(HAL_OSPI_Handle_T handle)
+{
+#ifdef CONFIG_ALIF_OSPI_STATS
+	struct hal_ospi_inst *ospi_inst;
+	uint32_t key;
+
+	ospi_inst = get_inst_by_handle(handle);
+	if (ospi_inst == NULL)
+		return OSPI_ERR_INVALID_HANDLE;
+
+	key = desc_queue_lock();
+	memset(&ospi_inst->stats, 0, sizeof(struct ospi_stats));
+	desc_queue_unlock(key);
+
+	return OSPI_ERR_NONE;
+#else
+	(void) handle;
+
+	return OSPI_ERR_INVALID_STATE;
+#endif
+}
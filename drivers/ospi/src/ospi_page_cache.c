@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "ospi_page_cache.h"
+
+/* Helper : cached page holding addr, or NULL */
+static struct ospi_cache_page *find_page(struct ospi_page_cache *cache,
+					uint32_t page_addr)
+{
+	uint32_t index;
+
+	for (index = 0; index < cache->num_pages; index++) {
+		if (cache->pages[index].valid &&
+			cache->pages[index].addr == page_addr)
+			return &cache->pages[index];
+	}
+
+	return NULL;
+}
+
+/* Helper : an empty page, else the least recently used one */
+static struct ospi_cache_page *victim_page(struct ospi_page_cache *cache)
+{
+	struct ospi_cache_page *victim = &cache->pages[0];
+	uint32_t index;
+
+	for (index = 0; index < cache->num_pages; index++) {
+		struct ospi_cache_page *page = &cache->pages[index];
+
+		if (!page->valid)
+			return page;
+
+		/* Wrap safe age compare */
+		if ((int32_t) (page->stamp - victim->stamp) < 0)
+			victim = page;
+	}
+
+	return victim;
+}
+
+/* Helper : data of a page */
+static inline uint8_t *page_data(struct ospi_page_cache *cache,
+				struct ospi_cache_page *page)
+{
+	return cache->data + (uint32_t) (page - cache->pages)
+				* cache->page_size;
+}
+
+int32_t ospi_page_cache_init(struct ospi_page_cache *cache,
+			struct ospi_cache_page *pages, uint8_t *data,
+			uint32_t page_size, uint32_t num_pages,
+			ospi_cache_read_fn read, void *ctx)
+{
+	if (cache == NULL || pages == NULL || data == NULL || read == NULL)
+		return OSPI_ERR_INVALID_PARAM;
+
+	if (num_pages == 0 || page_size == 0 ||
+		(page_size & (page_size - 1)) != 0)
+		return OSPI_ERR_INVALID_PARAM;
+
+	cache->pages = pages;
+	cache->data = data;
+	cache->page_size = page_size;
+	cache->num_pages = num_pages;
+	cache->clock = 0;
+	cache->read = read;
+	cache->ctx = ctx;
+
+	ospi_page_cache_invalidate_all(cache);
+	ospi_page_cache_reset_stats(cache);
+
+	return OSPI_ERR_NONE;
+}
+
+int32_t ospi_page_cache_read(struct ospi_page_cache *cache, uint32_t addr,
+			void *buf, uint32_t len)
+{
+	struct ospi_cache_page *page;
+	uint8_t *dst = buf;
+	uint32_t page_addr, offset, chunk;
+	int32_t ret;
+
+	if (cache == NULL || (buf == NULL && len != 0))
+		return OSPI_ERR_INVALID_PARAM;
+
+	while (len != 0) {
+		page_addr = addr & ~(cache->page_size - 1);
+		offset = addr - page_addr;
+		chunk = cache->page_size - offset;
+		if (chunk > len)
+			chunk = len;
+
+		page = find_page(cache, page_addr);
+		if (page != NULL) {
+			cache->hits++;
+		} else {
+			page = victim_page(cache);
+			page->valid = 0;
+
+			ret = cache->read(cache->ctx, page_addr,
+					page_data(cache, page),
+					cache->page_size);
+			if (ret != OSPI_ERR_NONE)
+				return ret;
+
+			page->addr = page_addr;
+			page->valid = 1;
+			cache->misses++;
+		}
+
+		page->stamp = ++cache->clock;
+
+		memcpy(dst, page_data(cache, page) + offset, chunk);
+
+		dst += chunk;
+		addr += chunk;
+		len -= chunk;
+	}
+
+	return OSPI_ERR_NONE;
+}
+
+void ospi_page_cache_invalidate(struct ospi_page_cache *cache, uint32_t addr,
+			uint32_t len)
+{
+	uint32_t first, last, index;
+
+	if (cache == NULL || len == 0)
+		return;
+
+	first = addr & ~(cache->page_size - 1);
+	last = (addr + len - 1) & ~(cache->page_size - 1);
+
+	for (index = 0; index < cache->num_pages; index++) {
+		struct ospi_cache_page *page = &cache->pages[index];
+
+		if (page->valid && page->addr >= first && page->addr <= last)
+			page->valid = 0;
+	}
+}
+
+void ospi_page_cache_invalidate_all(struct ospi_page_cache *cache)
+{
+	uint32_t index;
+
+	if (cache == NULL)
+		return;
+
+	for (index = 0; index < cache->num_pages; index++)
+		cache->pages[index].valid = 0;
+}
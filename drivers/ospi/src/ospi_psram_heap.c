@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "ospi_psram_heap.h"
+
+#define ALIGN_UP(x)     (((x) + OSPI_PSRAM_ALIGN - 1) & ~(OSPI_PSRAM_ALIGN - 1))
+#define ALIGN_MASK      ((uintptr_t) (OSPI_PSRAM_ALIGN - 1))
+
+/* Smaller remainders are not worth a sys_heap */
+#define HEAP_MIN_SIZE   256U
+
+int32_t ospi_psram_heap_init(struct ospi_psram_heap *heap, void *base,
+			uint32_t size, const struct ospi_psram_pool_cfg *pools,
+			uint32_t num_pools)
+{
+	uint8_t *start, *end, *cur;
+	uint32_t index;
+	struct ospi_psram_pool *pool;
+
+	if (heap == NULL || base == NULL || num_pools > OSPI_PSRAM_MAX_POOLS ||
+		(pools == NULL && num_pools != 0))
+		return OSPI_ERR_INVALID_PARAM;
+
+	memset(heap, 0, sizeof(struct ospi_psram_heap));
+
+	start = (uint8_t *) (((uintptr_t) base + ALIGN_MASK) & ~ALIGN_MASK);
+	end = (uint8_t *) base + size;
+	if (end < start)
+		return OSPI_ERR_INVALID_PARAM;
+
+	end = (uint8_t *) ((uintptr_t) end & ~ALIGN_MASK);
+	cur = start;
+
+	for (index = 0; index < num_pools; index++) {
+		pool = &heap->pools[index];
+
+		if (pools[index].block_size == 0 || pools[index].num_blocks == 0 ||
+			pools[index].block_size > UINT32_MAX - OSPI_PSRAM_ALIGN)
+			return OSPI_ERR_INVALID_PARAM;
+
+		/* Ascending sizes, the allocator takes the first that fits */
+		if (index != 0 &&
+			pools[index].block_size < pools[index - 1].block_size)
+			return OSPI_ERR_INVALID_PARAM;
+
+		pool->block_size = ALIGN_UP(pools[index].block_size);
+
+		if ((uint64_t) pool->block_size * pools[index].num_blocks >
+				(uint64_t) (end - cur))
+			return OSPI_ERR_INVALID_PARAM;
+
+		if (k_mem_slab_init(&pool->slab, cur, pool->block_size,
+				pools[index].num_blocks) != 0)
+			return OSPI_ERR_INVALID_PARAM;
+
+		pool->base = cur;
+		cur += pool->block_size * pools[index].num_blocks;
+		pool->end = cur;
+	}
+
+	heap->num_pools = num_pools;
+
+	/* The rest is the heap */
+	heap->heap_size = (uint32_t) (end - cur);
+
+	if (heap->heap_size >= HEAP_MIN_SIZE)
+		sys_heap_init(&heap->heap, cur, heap->heap_size);
+	else
+		heap->heap_size = 0;
+
+	return OSPI_ERR_NONE;
+}
+
+void *ospi_psram_alloc(struct ospi_psram_heap *heap, uint32_t size)
+{
+	k_spinlock_key_t key;
+	void *ptr = NULL;
+	uint32_t index;
+
+	if (heap == NULL || size == 0)
+		return NULL;
+
+	for (index = 0; index < heap->num_pools && ptr == NULL; index++) {
+		if (heap->pools[index].block_size >= size &&
+			k_mem_slab_alloc(&heap->pools[index].slab, &ptr,
+					K_NO_WAIT) != 0)
+			ptr = NULL;
+	}
+
+	/* Whole lines, the next chunk header starts on a new one */
+	if (ptr == NULL && heap->heap_size != 0 &&
+		size <= UINT32_MAX - OSPI_PSRAM_ALIGN) {
+		key = k_spin_lock(&heap->lock);
+		ptr = sys_heap_aligned_alloc(&heap->heap, OSPI_PSRAM_ALIGN,
+					ALIGN_UP(size));
+		k_spin_unlock(&heap->lock, key);
+	}
+
+	if (ptr == NULL)
+		atomic_inc(&heap->alloc_fails);
+
+	return ptr;
+}
+
+void ospi_psram_free(struct ospi_psram_heap *heap, void *ptr)
+{
+	struct ospi_psram_pool *pool;
+	k_spinlock_key_t key;
+	uint8_t *addr = ptr;
+	uint32_t index;
+
+	if (heap == NULL || ptr == NULL)
+		return;
+
+	for (index = 0; index < heap->num_pools; index++) {
+		pool = &heap->pools[index];
+
+		if (addr >= pool->base && addr < pool->end) {
+			k_mem_slab_free(&pool->slab, ptr);
+			return;
+		}
+	}
+
+	key = k_spin_lock(&heap->lock);
+	sys_heap_free(&heap->heap, ptr);
+	k_spin_unlock(&heap->lock, key);
+}
+
+void ospi_psram_get_stats(struct ospi_psram_heap *heap,
+			struct ospi_psram_stats *stats)
+{
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	struct sys_memory_stats heap_stats;
+	k_spinlock_key_t key;
+#endif
+	uint32_t index;
+
+	if (heap == NULL || stats == NULL)
+		return;
+
+	memset(stats, 0, sizeof(struct ospi_psram_stats));
+
+	for (index = 0; index < heap->num_pools; index++) {
+		struct ospi_psram_pool *pool = &heap->pools[index];
+
+		stats->pool_block_size[index] = pool->block_size;
+		stats->pool_in_use[index] = k_mem_slab_num_used_get(&pool->slab);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+		stats->pool_peak[index] = k_mem_slab_max_used_get(&pool->slab);
+#endif
+		stats->pool_free[index] = k_mem_slab_num_free_get(&pool->slab);
+	}
+
+	stats->num_pools = heap->num_pools;
+	stats->heap_size = heap->heap_size;
+	stats->alloc_fails = (uint32_t) atomic_get(&heap->alloc_fails);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	if (heap->heap_size == 0)
+		return;
+
+	key = k_spin_lock(&heap->lock);
+	sys_heap_runtime_stats_get(&heap->heap, &heap_stats);
+	k_spin_unlock(&heap->lock, key);
+
+	stats->heap_used = heap_stats.allocated_bytes;
+	stats->heap_peak = heap_stats.max_allocated_bytes;
+	stats->heap_free = heap_stats.free_bytes;
+#endif
+}
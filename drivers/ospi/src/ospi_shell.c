@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2024 Alif Semiconductor.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/shell/shell.h>
+
+#include "ospi_hal.h"
+
+/* Helper : instance handle from the command line */
+static int get_handle(const struct shell *sh, char **argv,
+			HAL_OSPI_Handle_T *handle)
+{
+	char *end;
+	long inst = strtol(argv[1], &end, 0);
+
+	if (*end != '\0' || inst < 0 || inst > INT8_MAX) {
+		shell_error(sh, "invalid instance: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	*handle = (HAL_OSPI_Handle_T) inst;
+
+	return 0;
+}
+
+static int cmd_ospi_stats_show(const struct shell *sh, size_t argc,
+			char **argv)
+{
+	struct ospi_stats stats;
+	HAL_OSPI_Handle_T handle;
+	uint32_t bin;
+	int ret;
+
+	ARG_UNUSED(argc);
+
+	ret = get_handle(sh, argv, &handle);
+	if (ret != 0)
+		return ret;
+
+	if (alif_hal_ospi_get_stats(handle, &stats) != OSPI_ERR_NONE) {
+		shell_error(sh, "no statistics for instance %d", handle);
+		return -ENODEV;
+	}
+
+	shell_print(sh, "transfers  : %u", stats.transfers);
+	shell_print(sh, "bytes      : %llu", (unsigned long long) stats.bytes);
+	shell_print(sh, "irqs       : %u (max %u per transfer)",
+			stats.irqs, stats.max_irqs_per_xfer);
+	shell_print(sh, "overflows  : %u", stats.overflows);
+	shell_print(sh, "underflows : %u", stats.underflows);
+	shell_print(sh, "xip switch : %u", stats.xip_switches);
+
+	if (stats.lat_samples == 0)
+		return 0;
+
+	shell_print(sh, "latency    : min %u max %u cycles",
+			stats.lat_min, stats.lat_max);
+
+	for (bin = 0; bin < OSPI_STATS_HIST_BINS; bin++) {
+		if (stats.lat_hist[bin] == 0)
+			continue;
+
+		shell_print(sh, "  < 2^%-2u   : %u", bin, stats.lat_hist[bin]);
+	}
+
+	return 0;
+}
+
+static int cmd_ospi_stats_reset(const struct shell *sh, size_t argc,
+			char **argv)
+{
+	HAL_OSPI_Handle_T handle;
+	int ret;
+
+	ARG_UNUSED(argc);
+
+	ret = get_handle(sh, argv, &handle);
+	if (ret != 0)
+		return ret;
+
+	if (alif_hal_ospi_reset_stats(handle) != OSPI_ERR_NONE) {
+		shell_error(sh, "no statistics for instance %d", handle);
+		return -ENODEV;
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_ospi_stats,
+	SHELL_CMD_ARG(show, NULL, "Show statistics <instance>",
+			cmd_ospi_stats_show, 2, 0),
+	SHELL_CMD_ARG(reset, NULL, "Clear statistics <instance>",
+			cmd_ospi_stats_reset, 2, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(ospi_stats, &sub_ospi_stats, "OSPI statistics", NULL);
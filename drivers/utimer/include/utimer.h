@@ -13,6 +13,13 @@
 #define UTIMER_GLB_DRIVER_OEN(global_addr)	(global_addr + 0x10U)
 #define UTIMER_GLB_CLOCK_ENABLE(global_addr)	(global_addr + 0x20U)
 
+/* Channel n registers follow the global registers in 4 KB blocks */
+#define UTIMER_CHAN_BASE(global_addr, chan)	\
+				((global_addr) + (0x1000U * ((chan) + 1U)))
+
+/* register access for the driver, its services and the accessors below */
+#define UTIMER_REG(addr)	(*(volatile uint32_t *)(uint32_t)(addr))
+
 #define UTIMER_START_0_SRC(timer_addr)		(timer_addr + 0x0000U)
 #define UTIMER_START_1_SRC(timer_addr)		(timer_addr + 0x0004U)
 #define UTIMER_STOP_0_SRC(timer_addr)		(timer_addr + 0x0008U)
@@ -66,6 +73,10 @@
 #define UTIMER_INT_CNTR_CTRL(timer_addr)	(timer_addr + 0x0130U)
 #define UTIMER_FAULT_CTRL(timer_addr)		(timer_addr + 0x0134U)
 
+/* Bit definition for the *_src_0 trigger source registers, global event n */
+#define CNTR_SRC0_TRIG_RISING(n)		(1U << (2U * (n)))
+#define CNTR_SRC0_TRIG_FALLING(n)		(1U << ((2U * (n)) + 1U))
+
 /* Bit definition for TIMER_RegInfo:cntr_start_src_1 register */
 #define CNTR_SRC1_DRIVER_A_RISING_B_0		(1 << 0)
 #define CNTR_SRC1_DRIVER_A_RISING_B_1		(1 << 1)
@@ -192,6 +203,27 @@
 /* Bit definition for TIMER_RegInfo:glb_clk_en register */
 #define GLB_CLK_EN				((uint32_t)0x0000FFFF)
 
+/**
+ * struct utimer_channel_config - complete channel setup, written by
+ * alif_utimer_config_channel() in one pass.
+ * @cntr_ctrl:    counter type and direction, CNTR_CTRL_* (EN is added)
+ * @reload:       counter pointer (period) value
+ * @counter:      initial counter value
+ * @compare_ctrl: COMPARE_CTRL_DRV_* bits for driver A and B
+ * @compare:      compare values for driver A and B
+ * @int_mask:     chan_interrupt_mask value, a set bit masks the event
+ * @soft_ctrl:    allow start/stop/clear through the global registers
+ */
+struct utimer_channel_config {
+	uint32_t cntr_ctrl;
+	uint32_t reload;
+	uint32_t counter;
+	uint32_t compare_ctrl[2];
+	uint32_t compare[2];
+	uint32_t int_mask;
+	bool soft_ctrl;
+};
+
 /**
  * \fn        void alif_utimer_enable_timer_clock(uint32_t reg_base,
  *                             uint8_t timer_id)
@@ -274,7 +306,10 @@ void alif_utimer_disable_soft_counter_ctrl(uint32_t reg_base);
  * \param[in] reg_base  register base address
  * \return    counter pointer register value
  */
-uint32_t alif_utimer_get_counter_reload_value(uint32_t reg_base);
+static inline uint32_t alif_utimer_get_counter_reload_value(uint32_t reg_base)
+{
+	return UTIMER_REG(UTIMER_CNTR_PTR(reg_base));
+}
 
 /**
  * \fn        void alif_utimer_set_counter_reload_value(uint32_t reg_base,
@@ -284,7 +319,11 @@ uint32_t alif_utimer_get_counter_reload_value(uint32_t reg_base);
  * \param[in] value  counter pointer register value to be set
  * \return    none
  */
-void alif_utimer_set_counter_reload_value(uint32_t reg_base, uint32_t value);
+static inline void alif_utimer_set_counter_reload_value(uint32_t reg_base,
+			uint32_t value)
+{
+	UTIMER_REG(UTIMER_CNTR_PTR(reg_base)) = value;
+}
 
 /**
  * \fn        uint32_t alif_utimer_get_counter_value(uint32_t reg_base)
@@ -292,7 +331,10 @@ void alif_utimer_set_counter_reload_value(uint32_t reg_base, uint32_t value);
  * \param[in] reg_base  register base address
  * \return    counter value
  */
-uint32_t alif_utimer_get_counter_value(uint32_t reg_base);
+static inline uint32_t alif_utimer_get_counter_value(uint32_t reg_base)
+{
+	return UTIMER_REG(UTIMER_CNTR(reg_base));
+}
 
 /**
  * \fn        void alif_utimer_set_counter_value(uint32_t reg_base,
@@ -302,7 +344,11 @@ uint32_t alif_utimer_get_counter_value(uint32_t reg_base);
  * \param[in] value  counter value to be set
  * \return    none
  */
-void alif_utimer_set_counter_value(uint32_t reg_base, uint32_t value);
+static inline void alif_utimer_set_counter_value(uint32_t reg_base,
+			uint32_t value)
+{
+	UTIMER_REG(UTIMER_CNTR(reg_base)) = value;
+}
 
 /**
  * \fn        void alif_utimer_clear_interrupt(uint32_t reg_base,
@@ -312,7 +358,12 @@ void alif_utimer_set_counter_value(uint32_t reg_base, uint32_t value);
  * \param[in] evt_bit  interrupt bit
  * \return    none
  */
-void alif_utimer_clear_interrupt(uint32_t reg_base, uint8_t evt_bit);
+static inline void alif_utimer_clear_interrupt(uint32_t reg_base,
+			uint8_t evt_bit)
+{
+	/* write 1 to clear, other pending events are left alone */
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base)) = (1U << evt_bit);
+}
 
 /**
  * \fn        void alif_utimer_enable_interrupt(uint32_t reg_base,
@@ -374,13 +425,58 @@ void alif_utimer_start_counter(uint32_t reg_base, uint8_t timer_id);
  */
 void alif_utimer_stop_counter(uint32_t reg_base, uint8_t timer_id);
 
+/**
+ * \fn        void alif_utimer_start_counters(uint32_t reg_base,
+ *                             uint32_t timer_mask)
+ * \brief     start a group of timer counters at the same instant.
+ * \param[in] reg_base    register base address
+ * \param[in] timer_mask  bit n selects timer instance n
+ * \return    none
+ */
+void alif_utimer_start_counters(uint32_t reg_base, uint32_t timer_mask);
+
+/**
+ * \fn        void alif_utimer_stop_counters(uint32_t reg_base,
+ *                             uint32_t timer_mask)
+ * \brief     stop a group of timer counters at the same instant.
+ * \param[in] reg_base    register base address
+ * \param[in] timer_mask  bit n selects timer instance n
+ * \return    none
+ */
+void alif_utimer_stop_counters(uint32_t reg_base, uint32_t timer_mask);
+
+/**
+ * \fn        void alif_utimer_clear_counters(uint32_t reg_base,
+ *                             uint32_t timer_mask)
+ * \brief     clear a group of timer counters at the same instant.
+ * \param[in] reg_base    register base address
+ * \param[in] timer_mask  bit n selects timer instance n
+ * \return    none
+ */
+void alif_utimer_clear_counters(uint32_t reg_base, uint32_t timer_mask);
+
+/**
+ * \fn        void alif_utimer_config_channel(uint32_t reg_base,
+ *                             const struct utimer_channel_config *cfg)
+ * \brief     configure a stopped channel in one pass. The counter is
+ *            disabled while the registers are written and enabled last.
+ * \param[in] reg_base  register base address
+ * \param[in] cfg       channel configuration
+ * \return    none
+ */
+void alif_utimer_config_channel(uint32_t reg_base,
+			const struct utimer_channel_config *cfg);
+
 /**
  * \fn        uint32_t alif_utimer_get_pending_interrupt(uint32_t reg_base)
  * \brief     stop timer counter.
  * \param[in] reg_base  register base address
  * \return    enabled interrupts which are pending
  */
-uint32_t alif_utimer_get_pending_interrupt(uint32_t reg_base);
+static inline uint32_t alif_utimer_get_pending_interrupt(uint32_t reg_base)
+{
+	return UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base));
+}
 
 /**
  * \fn        void alif_utimer_enable_compare_match(uint32_t reg_base,
@@ -411,8 +507,128 @@ void alif_utimer_disable_compare_match(uint32_t reg_base, uint8_t driver);
  * \param[in] compare_value value for compare register
  * \return    none
  */
-void alif_utimer_set_compare_value(uint32_t reg_base,
-		uint8_t driver, uint32_t compare_value);
+static inline void alif_utimer_set_compare_value(uint32_t reg_base,
+		uint8_t driver, uint32_t compare_value)
+{
+	if (driver) {
+		UTIMER_REG(UTIMER_COMPARE_B(reg_base)) = compare_value;
+	} else {
+		UTIMER_REG(UTIMER_COMPARE_A(reg_base)) = compare_value;
+	}
+}
+
+/**
+ * \fn        uint32_t alif_utimer_get_capture_value(uint32_t reg_base,
+ *                   uint8_t driver)
+ * \brief     read the latest capture of the driver.
+ * \param[in] reg_base  register base address
+ * \param[in] driver  driver type
+ * \return    capture value
+ */
+static inline uint32_t alif_utimer_get_capture_value(uint32_t reg_base,
+		uint8_t driver)
+{
+	if (driver) {
+		return UTIMER_REG(UTIMER_CAPTURE_B(reg_base));
+	}
+	return UTIMER_REG(UTIMER_CAPTURE_A(reg_base));
+}
+
+/**
+ * \fn        void alif_utimer_ack_interrupts(uint32_t reg_base,
+ *                   uint32_t mask)
+ * \brief     clear the pending interrupts in mask with one store.
+ * \param[in] reg_base  register base address
+ * \param[in] mask  CHAN_INTERRUPT_* bits
+ * \return    none
+ */
+static inline void alif_utimer_ack_interrupts(uint32_t reg_base, uint32_t mask)
+{
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base)) = mask;
+}
+
+/*
+ * Channel variants of the accessors above, addressed by the global
+ * register base and the channel number. With both known at compile
+ * time the register address folds to a constant and each access is a
+ * single load or store.
+ */
+
+/**
+ * \fn        uint32_t alif_utimer_chan_get_counter_value(uint32_t glb_base,
+ *                   uint8_t chan)
+ * \brief     read current counter value of a channel.
+ * \param[in] glb_base  global register base address
+ * \param[in] chan  channel
+ * \return    counter value
+ */
+static inline uint32_t alif_utimer_chan_get_counter_value(uint32_t glb_base,
+		uint8_t chan)
+{
+	return alif_utimer_get_counter_value(UTIMER_CHAN_BASE(glb_base, chan));
+}
+
+/**
+ * \fn        uint32_t alif_utimer_chan_get_capture_value(uint32_t glb_base,
+ *                   uint8_t chan, uint8_t driver)
+ * \brief     read the latest capture of a channel driver.
+ * \param[in] glb_base  global register base address
+ * \param[in] chan  channel
+ * \param[in] driver  driver type
+ * \return    capture value
+ */
+static inline uint32_t alif_utimer_chan_get_capture_value(uint32_t glb_base,
+		uint8_t chan, uint8_t driver)
+{
+	return alif_utimer_get_capture_value(UTIMER_CHAN_BASE(glb_base, chan),
+					     driver);
+}
+
+/**
+ * \fn        uint32_t alif_utimer_chan_get_pending_interrupt(uint32_t glb_base,
+ *                   uint8_t chan)
+ * \brief     read the pending interrupts of a channel.
+ * \param[in] glb_base  global register base address
+ * \param[in] chan  channel
+ * \return    CHAN_INTERRUPT_* bits
+ */
+static inline uint32_t alif_utimer_chan_get_pending_interrupt(uint32_t glb_base,
+		uint8_t chan)
+{
+	return alif_utimer_get_pending_interrupt(UTIMER_CHAN_BASE(glb_base, chan));
+}
+
+/**
+ * \fn        void alif_utimer_chan_ack_interrupts(uint32_t glb_base,
+ *                   uint8_t chan, uint32_t mask)
+ * \brief     clear pending interrupts of a channel with one store.
+ * \param[in] glb_base  global register base address
+ * \param[in] chan  channel
+ * \param[in] mask  CHAN_INTERRUPT_* bits
+ * \return    none
+ */
+static inline void alif_utimer_chan_ack_interrupts(uint32_t glb_base,
+		uint8_t chan, uint32_t mask)
+{
+	alif_utimer_ack_interrupts(UTIMER_CHAN_BASE(glb_base, chan), mask);
+}
+
+/**
+ * \fn        void alif_utimer_chan_set_compare_value(uint32_t glb_base,
+ *                   uint8_t chan, uint8_t driver, uint32_t compare_value)
+ * \brief     set the compare value of a channel driver.
+ * \param[in] glb_base  global register base address
+ * \param[in] chan  channel
+ * \param[in] driver  driver type
+ * \param[in] compare_value value for compare register
+ * \return    none
+ */
+static inline void alif_utimer_chan_set_compare_value(uint32_t glb_base,
+		uint8_t chan, uint8_t driver, uint32_t compare_value)
+{
+	alif_utimer_set_compare_value(UTIMER_CHAN_BASE(glb_base, chan), driver,
+				      compare_value);
+}
 
 /**
  * \fn     void alif_utimer_disable_driver(uint32_t reg_base, uint8_t driver)
@@ -520,6 +736,60 @@ void alif_utimer_set_driver_disable_val_high(uint32_t reg_base,
 void alif_utimer_set_driver_disable_val_low(uint32_t reg_base,
 			uint8_t driver);
 
+/*
+ * Compare DMA helpers only set up the timer side and give the register
+ * address. They do not program any DMA controller: the caller sets up
+ * the DMA channel, e.g. through the Zephyr DMA API, with the UTIMER
+ * request routed by alif_evtrtr_connect() and
+ * alif_utimer_get_compare_dma_addr() as the fixed destination.
+ */
+
+/**
+ * \fn        void alif_utimer_enable_compare_dma(uint32_t reg_base,
+ *                             uint8_t driver)
+ * \brief     prepare a driver for a DMA fed duty cycle stream. The DMA
+ *            request is cleared by the compare event, and each value the
+ *            DMA writes to alif_utimer_get_compare_dma_addr() is the
+ *            active compare value, taking effect at once. Time the DMA
+ *            request so the write lands away from the match. No DMA
+ *            channel is programmed here.
+ * \param[in] reg_base  register base address
+ * \param[in] driver    driver type
+ * \return    none
+ */
+void alif_utimer_enable_compare_dma(uint32_t reg_base, uint8_t driver);
+
+/**
+ * \fn        void alif_utimer_disable_compare_dma(uint32_t reg_base,
+ *                             uint8_t driver)
+ * \brief     stop the DMA requests of a driver.
+ * \param[in] reg_base  register base address
+ * \param[in] driver    driver type
+ * \return    none
+ */
+void alif_utimer_disable_compare_dma(uint32_t reg_base, uint8_t driver);
+
+/**
+ * \fn        uint32_t alif_utimer_get_compare_dma_addr(uint32_t reg_base,
+ *                             uint8_t driver)
+ * \brief     DMA destination of a duty cycle stream (compare_x), for
+ *            the caller's DMA channel setup.
+ * \param[in] reg_base  register base address
+ * \param[in] driver    driver type
+ * \return    register address
+ */
+uint32_t alif_utimer_get_compare_dma_addr(uint32_t reg_base, uint8_t driver);
+
+/**
+ * \fn        uint32_t alif_utimer_get_capture_dma_addr(uint32_t reg_base,
+ *                             uint8_t driver)
+ * \brief     DMA source of a capture stream (capture_x).
+ * \param[in] reg_base  register base address
+ * \param[in] driver    driver type
+ * \return    register address
+ */
+uint32_t alif_utimer_get_capture_dma_addr(uint32_t reg_base, uint8_t driver);
+
 /**
  * \fn  void alif_utimer_config_src1_trig_up_count(uint32_t reg_base,
  *                     uint32_t triggers)
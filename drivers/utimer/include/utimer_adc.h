@@ -0,0 +1,147 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef UTIMER_ADC_H_
+#define UTIMER_ADC_H_
+
+#include <stdint.h>
+#include <evtrtr.h>
+
+/*
+ * Hardware timed ADC sampling.
+ *
+ * A free running UTIMER channel raises a compare trigger once per
+ * sample period. The event router carries it to the ADC start of
+ * conversion input, so sample timing is set by the counter clock and
+ * no interrupt runs per sample. Results are moved by a circular DMA
+ * transfer, programmed by the caller on the ADC result request, into a
+ * ring of 32 bit entries. alif_utimer_adc_ring_read() consumes that
+ * ring given the number of entries the DMA has written since it was
+ * started, e.g. total_copied of dma_get_status() / 4.
+ *
+ * A running count, unlike the DMA write position, shows how many laps
+ * the DMA made. When it got more than size - 1 entries ahead, the
+ * overwritten entries are skipped and counted in lost, and reading
+ * resumes at the oldest entry still intact. The slot the DMA writes
+ * next is never read. The count is taken before the copy, so a DMA
+ * that laps the reader during the copy is not seen: read at least once
+ * per size / 2 samples. The ring is read through the CPU view, keep it
+ * in non-cacheable memory.
+ */
+
+/**
+ * struct utimer_adc_trigger_config - sample clock setup.
+ * @glb_base:      UTIMER global register base address
+ * @chan:          UTIMER channel used as sample clock
+ * @clk_hz:        UTIMER counter clock
+ * @rate_hz:       sample rate, clk_hz / rate_hz ticks are used
+ * @evtrtr:        event router between the timer and the ADC
+ * @evtrtr_chan:   router channel carrying the compare trigger of chan
+ * @evtrtr_group:  router group of that event
+ * @evtrtr_flags:  EVTRTR_ROUTE_* for the router channel
+ */
+struct utimer_adc_trigger_config {
+	uint32_t glb_base;
+	uint8_t chan;
+	uint32_t clk_hz;
+	uint32_t rate_hz;
+	enum evtrtr_instance evtrtr;
+	uint8_t evtrtr_chan;
+	uint8_t evtrtr_group;
+	uint32_t evtrtr_flags;
+};
+
+/**
+ * struct utimer_adc_trigger - sample clock state, owned by
+ *                             alif_utimer_adc_trigger_*.
+ */
+struct utimer_adc_trigger {
+	uint32_t glb_base;
+	uint32_t chan_base;
+	uint8_t chan;
+	uint32_t period;                /* ticks per sample */
+	enum evtrtr_instance evtrtr;
+	uint8_t evtrtr_chan;
+};
+
+/**
+ * struct utimer_adc_ring - consumer side of the DMA result ring.
+ */
+struct utimer_adc_ring {
+	const volatile uint32_t *buf;
+	uint32_t size;                  /* entries */
+	uint32_t tail;                  /* next entry to read, read % size */
+	uint64_t read;                  /* entries read or skipped */
+	uint64_t lost;                  /* entries overwritten unread */
+};
+
+/**
+ * \fn        int32_t alif_utimer_adc_trigger_init(struct utimer_adc_trigger *trig,
+ *                   const struct utimer_adc_trigger_config *cfg)
+ * \brief     configure the sample clock channel and claim the event
+ *            router channel. The counter is left stopped.
+ * \param[in] trig  sample clock state
+ * \param[in] cfg   setup
+ * \return    0 on success, -EINVAL on bad parameters, -EBUSY when the
+ *            router channel is in use with another routing
+ */
+int32_t alif_utimer_adc_trigger_init(struct utimer_adc_trigger *trig,
+			const struct utimer_adc_trigger_config *cfg);
+
+/**
+ * \fn        void alif_utimer_adc_trigger_deinit(struct utimer_adc_trigger *trig)
+ * \brief     stop the sample clock and release the router channel.
+ * \param[in] trig  sample clock state
+ * \return    none
+ */
+void alif_utimer_adc_trigger_deinit(struct utimer_adc_trigger *trig);
+
+/**
+ * \fn        void alif_utimer_adc_trigger_start(struct utimer_adc_trigger *trig)
+ * \brief     start sampling from counter 0, the first conversion starts
+ *            one period later. Program the DMA and arm the ADC first.
+ * \param[in] trig  sample clock state
+ * \return    none
+ */
+void alif_utimer_adc_trigger_start(struct utimer_adc_trigger *trig);
+
+/**
+ * \fn        void alif_utimer_adc_trigger_stop(struct utimer_adc_trigger *trig)
+ * \brief     stop sampling.
+ * \param[in] trig  sample clock state
+ * \return    none
+ */
+void alif_utimer_adc_trigger_stop(struct utimer_adc_trigger *trig);
+
+/**
+ * \fn        int32_t alif_utimer_adc_ring_init(struct utimer_adc_ring *ring,
+ *                   const volatile uint32_t *buf, uint32_t size)
+ * \brief     attach to the DMA destination buffer, empty. Call it
+ *            before the DMA is started, the written count given to
+ *            alif_utimer_adc_ring_read() starts from 0 here.
+ * \param[in] ring  ring state
+ * \param[in] buf   DMA destination, size entries
+ * \param[in] size  entries, at least 2
+ * \return    0 on success, -EINVAL on bad parameters
+ */
+int32_t alif_utimer_adc_ring_init(struct utimer_adc_ring *ring,
+			const volatile uint32_t *buf, uint32_t size);
+
+/**
+ * \fn        int32_t alif_utimer_adc_ring_read(struct utimer_adc_ring *ring,
+ *                   uint64_t written, uint32_t *out, uint32_t max)
+ * \brief     copy out the results written since the last read. Results
+ *            the DMA has overwritten are skipped and added to ring->lost.
+ * \param[in]  ring     ring state
+ * \param[in]  written  entries written by the DMA since it was started
+ * \param[out] out      results, oldest first
+ * \param[in]  max      room in out
+ * \return    number of results copied, -EINVAL if written is below the
+ *            entries already consumed
+ */
+int32_t alif_utimer_adc_ring_read(struct utimer_adc_ring *ring,
+			uint64_t written, uint32_t *out, uint32_t max);
+
+#endif /* UTIMER_ADC_H_ */
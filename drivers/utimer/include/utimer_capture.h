@@ -0,0 +1,133 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef UTIMER_CAPTURE_H_
+#define UTIMER_CAPTURE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Input capture streaming.
+ *
+ * Capture events of one driver (A or B) of a free running up counter
+ * are collected into a single producer / single consumer ring of 64 bit
+ * timestamps. Each capture interrupt reads capture_x once and times it
+ * back from the counter at interrupt time, the counter overflow
+ * interrupt extends the timestamps past 32 bits. The interrupt must run
+ * before the next edge, an edge it misses is overwritten in capture_x,
+ * and within a period of the edge it reads.
+ *
+ * For edge rates above what the interrupt can follow, a DMA channel can
+ * copy capture_x (alif_utimer_get_capture_dma_addr()) into memory on
+ * each capture event. alif_utimer_capture_push_raw() then extends and
+ * queues the raw values. In that mode the gap between two edges must be
+ * shorter than one counter period.
+ */
+
+/**
+ * struct utimer_capture_stream - capture ring and timestamp state.
+ * Fields are owned by the alif_utimer_capture_* functions.
+ */
+struct utimer_capture_stream {
+	uint32_t reg_base;              /* channel register base */
+	uint8_t driver;                 /* 0: capture A, 1: capture B */
+	uint64_t *buf;                  /* ring storage */
+	uint32_t mask;                  /* ring size - 1 */
+	volatile uint32_t head;         /* written by the producer */
+	volatile uint32_t tail;         /* written by the consumer */
+	uint64_t period;                /* counter pointer + 1 */
+	uint32_t wraps;                 /* counter overflows seen */
+	uint32_t last_raw;              /* newest queued capture value */
+	uint32_t dropped;               /* captures lost to a full ring */
+};
+
+/**
+ * \fn        int32_t alif_utimer_capture_init(
+ *                   struct utimer_capture_stream *stream,
+ *                   uint32_t reg_base, uint8_t driver,
+ *                   uint64_t *buf, uint32_t size)
+ * \brief     set up a capture stream.
+ * \param[in] stream    stream state
+ * \param[in] reg_base  channel register base address
+ * \param[in] driver    driver type
+ * \param[in] buf       ring storage
+ * \param[in] size      ring entries, power of two
+ * \return    0 on success, -EINVAL on bad parameters
+ */
+int32_t alif_utimer_capture_init(struct utimer_capture_stream *stream,
+			uint32_t reg_base, uint8_t driver,
+			uint64_t *buf, uint32_t size);
+
+/**
+ * \fn        void alif_utimer_capture_start(
+ *                   struct utimer_capture_stream *stream)
+ * \brief     unmask the capture and overflow interrupts. The counter
+ *            and the capture trigger are configured and started by the
+ *            caller.
+ * \param[in] stream  stream state
+ * \return    none
+ */
+void alif_utimer_capture_start(struct utimer_capture_stream *stream);
+
+/**
+ * \fn        void alif_utimer_capture_stop(
+ *                   struct utimer_capture_stream *stream)
+ * \brief     mask the capture and overflow interrupts.
+ * \param[in] stream  stream state
+ * \return    none
+ */
+void alif_utimer_capture_stop(struct utimer_capture_stream *stream);
+
+/**
+ * \fn        void alif_utimer_capture_isr(
+ *                   struct utimer_capture_stream *stream)
+ * \brief     interrupt handler body for the capture and overflow
+ *            interrupts of the channel.
+ * \param[in] stream  stream state
+ * \return    none
+ */
+void alif_utimer_capture_isr(struct utimer_capture_stream *stream);
+
+/**
+ * \fn        void alif_utimer_capture_push_raw(
+ *                   struct utimer_capture_stream *stream,
+ *                   const uint32_t *raw, uint32_t count)
+ * \brief     extend and queue raw capture values copied by DMA.
+ * \param[in] stream  stream state
+ * \param[in] raw     capture values, oldest first
+ * \param[in] count   number of values
+ * \return    none
+ */
+void alif_utimer_capture_push_raw(struct utimer_capture_stream *stream,
+			const uint32_t *raw, uint32_t count);
+
+/**
+ * \fn        uint32_t alif_utimer_capture_read(
+ *                   struct utimer_capture_stream *stream,
+ *                   uint64_t *ts, uint32_t max)
+ * \brief     take timestamps from the ring, oldest first.
+ * \param[in]  stream  stream state
+ * \param[out] ts      timestamps in counter ticks
+ * \param[in]  max     room in ts
+ * \return    number of timestamps taken
+ */
+uint32_t alif_utimer_capture_read(struct utimer_capture_stream *stream,
+			uint64_t *ts, uint32_t max);
+
+/**
+ * \fn        uint32_t alif_utimer_capture_count(
+ *                   const struct utimer_capture_stream *stream)
+ * \brief     number of timestamps waiting in the ring.
+ * \param[in] stream  stream state
+ * \return    timestamps waiting
+ */
+static inline uint32_t alif_utimer_capture_count(
+			const struct utimer_capture_stream *stream)
+{
+	return stream->head - stream->tail;
+}
+
+#endif /* UTIMER_CAPTURE_H_ */
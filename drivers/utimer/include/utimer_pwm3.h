@@ -0,0 +1,178 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef UTIMER_PWM3_H_
+#define UTIMER_PWM3_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * 3-phase center aligned complementary PWM.
+ *
+ * Each phase is a channel counting up and down (0 -> period -> 0).
+ * Driver A is the high side. It starts low and toggles on the compare A
+ * match going up and going down, so it is high for duty ticks around
+ * the peak. Driver B is the low side. It starts high and toggles on the
+ * compare B match, which sits dead_time ticks below compare A, so B is
+ * low for duty + 2 * dead_time ticks around the peak and the two drivers
+ * are never high together. The dead time is generated in software this
+ * way, the channel dead time logic is not used.
+ *
+ * Compare values are not buffered, alif_utimer_pwm3_set_duties() writes
+ * the active registers. Call it from the underflow (valley) interrupt of
+ * the first phase, and have it done within margin ticks of the valley:
+ * every compare value is at least margin, so no match is passed while
+ * the registers change. A match missed because of a late update leaves
+ * the toggling drivers inverted. The phases are started and stopped
+ * through the global registers on the same clock.
+ */
+
+#define UTIMER_PWM3_PHASES	3U
+
+/**
+ * struct utimer_pwm3_config - PWM setup.
+ * @glb_base:   UTIMER global register base address
+ * @chan:       channel of phase U, V and W
+ * @period:     ticks from valley to peak, the PWM period is 2 * period
+ * @dead_time:  ticks between one driver going low and the other going
+ *              high, on both edges
+ * @margin:     ticks after the valley by which set_duties() is done, at
+ *              least 1
+ */
+struct utimer_pwm3_config {
+	uint32_t glb_base;
+	uint8_t chan[UTIMER_PWM3_PHASES];
+	uint32_t period;
+	uint32_t dead_time;
+	uint32_t margin;
+};
+
+/**
+ * struct utimer_pwm3 - PWM state, owned by alif_utimer_pwm3_*.
+ */
+struct utimer_pwm3 {
+	uint32_t glb_base;
+	uint32_t chan_base[UTIMER_PWM3_PHASES];
+	uint8_t chan[UTIMER_PWM3_PHASES];
+	uint32_t chan_mask;                             /* group start mask */
+	uint32_t period;
+	uint32_t dead_time;
+	uint32_t margin;
+	volatile uint32_t *cmp_a[UTIMER_PWM3_PHASES];   /* compare_a */
+	volatile uint32_t *cmp_b[UTIMER_PWM3_PHASES];   /* compare_b */
+};
+
+/**
+ * \fn        int32_t alif_utimer_pwm3_init(struct utimer_pwm3 *pwm,
+ *                   const struct utimer_pwm3_config *cfg)
+ * \brief     configure the three channels with 0 % duty, outputs off.
+ * \param[in] pwm  PWM state
+ * \param[in] cfg  setup
+ * \return    0 on success, -EINVAL on bad parameters
+ */
+int32_t alif_utimer_pwm3_init(struct utimer_pwm3 *pwm,
+			const struct utimer_pwm3_config *cfg);
+
+/**
+ * \fn        void alif_utimer_pwm3_start(struct utimer_pwm3 *pwm)
+ * \brief     enable the outputs and start all phases together.
+ * \param[in] pwm  PWM state
+ * \return    none
+ */
+void alif_utimer_pwm3_start(struct utimer_pwm3 *pwm);
+
+/**
+ * \fn        void alif_utimer_pwm3_stop(struct utimer_pwm3 *pwm)
+ * \brief     stop all phases together and disable the outputs.
+ * \param[in] pwm  PWM state
+ * \return    none
+ */
+void alif_utimer_pwm3_stop(struct utimer_pwm3 *pwm);
+
+/**
+ * \fn        int32_t alif_utimer_pwm3_set_dead_time(struct utimer_pwm3 *pwm,
+ *                   uint32_t dead_time)
+ * \brief     change the dead time, used from the next
+ *            alif_utimer_pwm3_set_duties() call on.
+ * \param[in] pwm        PWM state
+ * \param[in] dead_time  ticks between the drivers on both edges
+ * \return    0 on success, -EINVAL if dead_time + margin >= period
+ */
+int32_t alif_utimer_pwm3_set_dead_time(struct utimer_pwm3 *pwm,
+			uint32_t dead_time);
+
+/**
+ * \fn        uint32_t alif_utimer_pwm3_compare(const struct utimer_pwm3 *pwm,
+ *                   uint32_t duty)
+ * \brief     compare A value for a high side on-time of duty ticks per
+ *            half period. 0 never matches and keeps the high side off.
+ *            The on-time saturates at period - dead_time - margin, which
+ *            keeps compare B at or above margin.
+ * \param[in] pwm   PWM state
+ * \param[in] duty  on-time, 0 .. period
+ * \return    compare A value
+ */
+static inline uint32_t alif_utimer_pwm3_compare(const struct utimer_pwm3 *pwm,
+			uint32_t duty)
+{
+	uint32_t min = pwm->dead_time + pwm->margin;
+
+	if (duty == 0) {
+		return pwm->period + 1;
+	}
+	if (duty >= pwm->period - min) {
+		return min;
+	}
+	return pwm->period - duty;
+}
+
+/**
+ * \fn        uint32_t alif_utimer_pwm3_compare_low(const struct utimer_pwm3 *pwm,
+ *                   uint32_t cmp)
+ * \brief     compare B value of the low side for compare A value cmp.
+ *            With the high side off the low side stays on.
+ * \param[in] pwm  PWM state
+ * \param[in] cmp  compare A value from alif_utimer_pwm3_compare()
+ * \return    compare B value
+ */
+static inline uint32_t alif_utimer_pwm3_compare_low(const struct utimer_pwm3 *pwm,
+			uint32_t cmp)
+{
+	if (cmp > pwm->period) {
+		return cmp;
+	}
+	return cmp - pwm->dead_time;
+}
+
+/**
+ * \fn        void alif_utimer_pwm3_set_duties(struct utimer_pwm3 *pwm,
+ *                   uint32_t a, uint32_t b, uint32_t c)
+ * \brief     set the on-time of the three phases, see
+ *            alif_utimer_pwm3_compare(). The values take effect at once,
+ *            call it from the valley interrupt only.
+ * \param[in] pwm  PWM state
+ * \param[in] a    phase U on-time, ticks
+ * \param[in] b    phase V on-time, ticks
+ * \param[in] c    phase W on-time, ticks
+ * \return    none
+ */
+static inline void alif_utimer_pwm3_set_duties(struct utimer_pwm3 *pwm,
+			uint32_t a, uint32_t b, uint32_t c)
+{
+	uint32_t cmp[UTIMER_PWM3_PHASES] = {
+		alif_utimer_pwm3_compare(pwm, a),
+		alif_utimer_pwm3_compare(pwm, b),
+		alif_utimer_pwm3_compare(pwm, c),
+	};
+	uint32_t i;
+
+	for (i = 0; i < UTIMER_PWM3_PHASES; i++) {
+		*pwm->cmp_a[i] = cmp[i];
+		*pwm->cmp_b[i] = alif_utimer_pwm3_compare_low(pwm, cmp[i]);
+	}
+}
+
+#endif /* UTIMER_PWM3_H_ */
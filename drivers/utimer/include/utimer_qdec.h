@@ -0,0 +1,123 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef UTIMER_QDEC_H_
+#define UTIMER_QDEC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Quadrature decoder position / velocity service.
+ *
+ * One channel counts encoder edges in QDEC mode over the full 32 bit
+ * range. A second, free running channel sets the sample rate with its
+ * compare A interrupt and timestamps encoder edges in its capture A
+ * register without interrupts. Each sample extends the position to 64
+ * bits and estimates the velocity with the M/T method. The M edges
+ * counted since the previous sample are divided by the time between the
+ * last edge before that sample and the last edge before this one. When
+ * no edge arrives, the estimate decays as 1 / (time since the last
+ * edge) and reads 0 after idle_ticks.
+ *
+ * Edge timestamps are differences of 32 bit counter values. Samples must
+ * be less than 2^32 ticks apart, and idle_ticks must stay below that.
+ */
+
+struct utimer_qdec;
+
+typedef void (*utimer_qdec_cb)(const struct utimer_qdec *qdec, void *user_data);
+
+/**
+ * struct utimer_qdec_config - QDEC service setup.
+ * @qdec_base:       channel counting the encoder
+ * @sample_base:     free running channel for sampling and timestamps
+ * @sample_period:   ticks of the sample channel between samples
+ * @clk_hz:          sample channel counter clock
+ * @edge_src0:       trig_capture_src_a0 of the sample channel, the
+ *                   events of the encoder edges
+ * @edge_src1:       trig_capture_src_a1 of the sample channel
+ * @filter_prescaler: QDEC input filter prescaler, 0 leaves it off
+ * @filter_taps:     QDEC input filter taps
+ * @idle_ticks:      ticks without an edge before the velocity is 0
+ * @cb:              called from the sample interrupt, may be NULL
+ * @user_data:       passed to cb
+ */
+struct utimer_qdec_config {
+	uint32_t qdec_base;
+	uint32_t sample_base;
+	uint32_t sample_period;
+	uint32_t clk_hz;
+	uint32_t edge_src0;
+	uint32_t edge_src1;
+	uint8_t filter_prescaler;
+	uint8_t filter_taps;
+	uint32_t idle_ticks;
+	utimer_qdec_cb cb;
+	void *user_data;
+};
+
+/**
+ * struct utimer_qdec - QDEC service state, owned by alif_utimer_qdec_*.
+ */
+struct utimer_qdec {
+	struct utimer_qdec_config cfg;
+	volatile uint32_t seq;          /* odd while a sample is written */
+	int64_t position;               /* counts */
+	int32_t velocity;               /* counts per second */
+	uint32_t last_cnt;              /* QDEC counter at the last sample */
+	uint32_t last_edge;             /* timestamp of the last edge */
+	bool edge_valid;                /* last_edge is usable */
+	int8_t dir;                     /* sign of the last movement */
+	uint32_t samples;               /* sample interrupts served */
+};
+
+/**
+ * \fn        int32_t alif_utimer_qdec_init(struct utimer_qdec *qdec,
+ *                   const struct utimer_qdec_config *cfg)
+ * \brief     configure both channels and reset position and velocity.
+ *            The counters are started by the caller, together with
+ *            alif_utimer_start_counters().
+ * \param[in] qdec  service state
+ * \param[in] cfg   setup
+ * \return    0 on success, -EINVAL on bad parameters
+ */
+int32_t alif_utimer_qdec_init(struct utimer_qdec *qdec,
+			const struct utimer_qdec_config *cfg);
+
+/**
+ * \fn        void alif_utimer_qdec_sample_isr(struct utimer_qdec *qdec)
+ * \brief     compare A interrupt handler body of the sample channel.
+ * \param[in] qdec  service state
+ * \return    none
+ */
+void alif_utimer_qdec_sample_isr(struct utimer_qdec *qdec);
+
+/**
+ * \fn        void alif_utimer_qdec_get(const struct utimer_qdec *qdec,
+ *                   int64_t *position, int32_t *velocity)
+ * \brief     read a consistent position / velocity pair. Call from a
+ *            thread, the callback, or an interrupt that can not preempt
+ *            the sample interrupt.
+ * \param[in]  qdec      service state
+ * \param[out] position  counts, may be NULL
+ * \param[out] velocity  counts per second, may be NULL
+ * \return    none
+ */
+void alif_utimer_qdec_get(const struct utimer_qdec *qdec,
+			int64_t *position, int32_t *velocity);
+
+/**
+ * \fn        int32_t alif_utimer_qdec_velocity(int32_t edges,
+ *                   uint32_t dt, uint32_t clk_hz)
+ * \brief     M/T velocity, edges counted over dt ticks. Pure function.
+ * \param[in] edges   signed edge count
+ * \param[in] dt      ticks, not 0
+ * \param[in] clk_hz  tick rate
+ * \return    counts per second, saturated to int32_t
+ */
+int32_t alif_utimer_qdec_velocity(int32_t edges, uint32_t dt, uint32_t clk_hz);
+
+#endif /* UTIMER_QDEC_H_ */
@@ -0,0 +1,96 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef UTIMER_TIMEBASE_H_
+#define UTIMER_TIMEBASE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * 64 bit monotonic timebase on a free running UTIMER up counter.
+ *
+ * The overflow interrupt counts wraps in a single 32 bit word, updated
+ * with interrupts masked together with clearing the overflow status.
+ * Readers take the wrap count, the counter and the pending overflow
+ * status, and retry only if the overflow interrupt ran in between, so
+ * alif_utimer_timebase_now() is safe from any context, including
+ * interrupts of higher priority than the overflow interrupt.
+ *
+ * The overflow interrupt must be served within half a counter period.
+ */
+
+/**
+ * struct utimer_timebase - timebase state.
+ */
+struct utimer_timebase {
+	uint32_t reg_base;              /* channel register base */
+	uint64_t period;                /* counter pointer + 1 */
+	volatile uint32_t wraps;        /* overflows counted */
+};
+
+/**
+ * \fn        uint64_t alif_utimer_timebase_extend(uint32_t wraps,
+ *                   uint32_t cnt, bool ovf_pending, uint64_t period)
+ * \brief     combine a wrap count and a counter value into 64 bits. A
+ *            value from the lower half of the period seen with the
+ *            overflow still pending was taken after an uncounted wrap.
+ *            Pure function, no register access.
+ * \param[in] wraps        overflows counted so far
+ * \param[in] cnt          counter or capture value
+ * \param[in] ovf_pending  overflow status was set when cnt was read
+ * \param[in] period       counter pointer + 1
+ * \return    ticks since the counter started
+ */
+static inline uint64_t alif_utimer_timebase_extend(uint32_t wraps,
+			uint32_t cnt, bool ovf_pending, uint64_t period)
+{
+	uint64_t w = wraps;
+
+	if (ovf_pending && cnt < (period / 2)) {
+		w++;
+	}
+
+	return (w * period) + cnt;
+}
+
+/**
+ * \fn        void alif_utimer_timebase_init(struct utimer_timebase *tb,
+ *                   uint32_t reg_base)
+ * \brief     set up a timebase on a configured up counter, the period is
+ *            read from the counter pointer.
+ * \param[in] tb        timebase state
+ * \param[in] reg_base  channel register base address
+ * \return    none
+ */
+void alif_utimer_timebase_init(struct utimer_timebase *tb, uint32_t reg_base);
+
+/**
+ * \fn        void alif_utimer_timebase_start(struct utimer_timebase *tb)
+ * \brief     clear and unmask the overflow interrupt. The counter is
+ *            started by the caller.
+ * \param[in] tb  timebase state
+ * \return    none
+ */
+void alif_utimer_timebase_start(struct utimer_timebase *tb);
+
+/**
+ * \fn        void alif_utimer_timebase_overflow_isr(
+ *                   struct utimer_timebase *tb)
+ * \brief     overflow interrupt handler body.
+ * \param[in] tb  timebase state
+ * \return    none
+ */
+void alif_utimer_timebase_overflow_isr(struct utimer_timebase *tb);
+
+/**
+ * \fn        uint64_t alif_utimer_timebase_now(struct utimer_timebase *tb)
+ * \brief     current time in counter ticks.
+ * \param[in] tb  timebase state
+ * \return    ticks since the counter started
+ */
+uint64_t alif_utimer_timebase_now(struct utimer_timebase *tb);
+
+#endif /* UTIMER_TIMEBASE_H_ */
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <utimer.h>
+#include <utimer_adc.h>
+#include <evtrtr.h>
+
+int32_t alif_utimer_adc_trigger_init(struct utimer_adc_trigger *trig,
+			const struct utimer_adc_trigger_config *cfg)
+{
+	struct utimer_channel_config ch = { 0 };
+	uint32_t period;
+	int32_t ret;
+
+	if (trig == NULL || cfg == NULL || cfg->rate_hz == 0) {
+		return -EINVAL;
+	}
+
+	period = cfg->clk_hz / cfg->rate_hz;
+	if (period < 2) {
+		return -EINVAL;
+	}
+
+	ret = alif_evtrtr_connect(cfg->evtrtr, cfg->evtrtr_chan,
+				  cfg->evtrtr_group, cfg->evtrtr_flags);
+	if (ret) {
+		return ret;
+	}
+
+	trig->glb_base = cfg->glb_base;
+	trig->chan_base = UTIMER_CHAN_BASE(cfg->glb_base, cfg->chan);
+	trig->chan = cfg->chan;
+	trig->period = period;
+	trig->evtrtr = cfg->evtrtr;
+	trig->evtrtr_chan = cfg->evtrtr_chan;
+
+	/* one compare trigger per period, at the end of it, no interrupts */
+	ch.cntr_ctrl = CNTR_CTRL_SAWTOOTH;
+	ch.reload = period - 1;
+	ch.compare[0] = period - 1;
+	ch.compare_ctrl[0] = COMPARE_CTRL_DRV_COMPARE_EN |
+			     COMPARE_CTRL_DRV_COMPARE_TRIG_EN;
+	ch.int_mask = UINT32_MAX;
+	ch.soft_ctrl = true;
+
+	alif_utimer_enable_timer_clock(cfg->glb_base, cfg->chan);
+	alif_utimer_config_channel(trig->chan_base, &ch);
+
+	return 0;
+}
+
+void alif_utimer_adc_trigger_deinit(struct utimer_adc_trigger *trig)
+{
+	alif_utimer_adc_trigger_stop(trig);
+	alif_evtrtr_release(trig->evtrtr, trig->evtrtr_chan);
+}
+
+void alif_utimer_adc_trigger_start(struct utimer_adc_trigger *trig)
+{
+	alif_utimer_clear_counters(trig->glb_base, 1U << trig->chan);
+	alif_utimer_start_counters(trig->glb_base, 1U << trig->chan);
+}
+
+void alif_utimer_adc_trigger_stop(struct utimer_adc_trigger *trig)
+{
+	alif_utimer_stop_counters(trig->glb_base, 1U << trig->chan);
+}
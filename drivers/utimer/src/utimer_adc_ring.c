@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <cmsis_core.h>
+#include <utimer_adc.h>
+
+int32_t alif_utimer_adc_ring_init(struct utimer_adc_ring *ring,
+			const volatile uint32_t *buf, uint32_t size)
+{
+	if (ring == NULL || buf == NULL || size < 2) {
+		return -EINVAL;
+	}
+
+	ring->buf = buf;
+	ring->size = size;
+	ring->tail = 0;
+	ring->read = 0;
+	ring->lost = 0;
+
+	return 0;
+}
+
+int32_t alif_utimer_adc_ring_read(struct utimer_adc_ring *ring,
+			uint64_t written, uint32_t *out, uint32_t max)
+{
+	uint64_t avail, skip;
+	uint32_t tail = ring->tail;
+	uint32_t n;
+
+	if (written < ring->read) {
+		return -EINVAL;
+	}
+
+	avail = written - ring->read;
+
+	/* the DMA lapped the reader, keep what it has not reached again */
+	if (avail > ring->size - 1) {
+		skip = avail - (ring->size - 1);
+		tail = (uint32_t) ((tail + skip % ring->size) % ring->size);
+		ring->read += skip;
+		ring->lost += skip;
+		avail = ring->size - 1;
+	}
+
+	if (max > avail) {
+		max = (uint32_t) avail;
+	}
+
+	/* results are read after the DMA count was */
+	__DMB();
+
+	for (n = 0; n < max; n++) {
+		out[n] = ring->buf[tail];
+		if (++tail == ring->size) {
+			tail = 0;
+		}
+	}
+
+	ring->tail = tail;
+	ring->read += n;
+
+	return (int32_t) n;
+}
@@ -0,0 +1,166 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <cmsis_core.h>
+#include <utimer.h>
+#include <utimer_capture.h>
+#include <utimer_timebase.h>
+
+static inline uint32_t capture_irq_bit(const struct utimer_capture_stream *stream)
+{
+	return stream->driver ? CHAN_INTERRUPT_CAPTURE_B : CHAN_INTERRUPT_CAPTURE_A;
+}
+
+static void push(struct utimer_capture_stream *stream, uint64_t ts)
+{
+	uint32_t head = stream->head;
+
+	if ((head - stream->tail) > stream->mask) {
+		stream->dropped++;
+		return;
+	}
+
+	stream->buf[head & stream->mask] = ts;
+
+	/* entry must be visible before the consumer sees the new head */
+	__DMB();
+	stream->head = head + 1;
+}
+
+static inline uint32_t read_capture(const struct utimer_capture_stream *stream)
+{
+	return alif_utimer_get_capture_value(stream->reg_base, stream->driver);
+}
+
+int32_t alif_utimer_capture_init(struct utimer_capture_stream *stream,
+			uint32_t reg_base, uint8_t driver,
+			uint64_t *buf, uint32_t size)
+{
+	if (stream == NULL || buf == NULL || size == 0 ||
+	    (size & (size - 1)) != 0 || driver > 1) {
+		return -EINVAL;
+	}
+
+	stream->reg_base = reg_base;
+	stream->driver = driver;
+	stream->buf = buf;
+	stream->mask = size - 1;
+	stream->head = 0;
+	stream->tail = 0;
+	stream->wraps = 0;
+	stream->last_raw = 0;
+	stream->dropped = 0;
+	stream->period = (uint64_t)alif_utimer_get_counter_reload_value(reg_base) + 1;
+
+	return 0;
+}
+
+void alif_utimer_capture_start(struct utimer_capture_stream *stream)
+{
+	uint32_t reg_base = stream->reg_base;
+
+	stream->period = (uint64_t)alif_utimer_get_counter_reload_value(reg_base) + 1;
+
+	/* anything already latched is history */
+	stream->last_raw = read_capture(stream);
+
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base)) = capture_irq_bit(stream) |
+					       CHAN_INTERRUPT_OVER_FLOW;
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT_MASK(reg_base)) &= ~(capture_irq_bit(stream) |
+						       CHAN_INTERRUPT_OVER_FLOW);
+}
+
+void alif_utimer_capture_stop(struct utimer_capture_stream *stream)
+{
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT_MASK(stream->reg_base)) |= (capture_irq_bit(stream) |
+							      CHAN_INTERRUPT_OVER_FLOW);
+}
+
+/* ticks from capture a forward to capture b, less than one period apart */
+static inline uint32_t capture_delta(uint32_t a, uint32_t b, uint64_t period)
+{
+	return (b >= a) ? (b - a) : (uint32_t)(b + period - a);
+}
+
+void alif_utimer_capture_isr(struct utimer_capture_stream *stream)
+{
+	uint32_t reg_base = stream->reg_base;
+	uint32_t pending, raw, cnt;
+	bool ovf;
+
+	pending = UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base));
+	ovf = (pending & CHAN_INTERRUPT_OVER_FLOW) != 0;
+
+	while (pending & capture_irq_bit(stream)) {
+		raw = read_capture(stream);
+		cnt = alif_utimer_get_counter_value(reg_base);
+		ovf = (UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base)) &
+		       CHAN_INTERRUPT_OVER_FLOW) != 0;
+
+		/* cleared after the read, so a set status always means a new edge */
+		UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base)) = capture_irq_bit(stream);
+
+		/* the capture is less than a period before the counter read */
+		push(stream, alif_utimer_timebase_extend(stream->wraps, cnt, ovf,
+							 stream->period) -
+			     capture_delta(raw, cnt, stream->period));
+		stream->last_raw = raw;
+
+		/* an edge between the read and the clear left no status behind */
+		if (read_capture(stream) == raw) {
+			break;
+		}
+	}
+
+	if (ovf) {
+		UTIMER_REG(UTIMER_CHAN_INTERRUPT(reg_base)) = CHAN_INTERRUPT_OVER_FLOW;
+		stream->wraps++;
+	}
+}
+
+void alif_utimer_capture_push_raw(struct utimer_capture_stream *stream,
+			const uint32_t *raw, uint32_t count)
+{
+	uint32_t i;
+
+	for (i = 0; i < count; i++) {
+		/* edges are less than a period apart, going back means a wrap */
+		if (raw[i] < stream->last_raw) {
+			stream->wraps++;
+		}
+		stream->last_raw = raw[i];
+
+		push(stream, alif_utimer_timebase_extend(stream->wraps,
+						raw[i], false, stream->period));
+	}
+}
+
+uint32_t alif_utimer_capture_read(struct utimer_capture_stream *stream,
+			uint64_t *ts, uint32_t max)
+{
+	uint32_t tail = stream->tail;
+	uint32_t avail = stream->head - tail;
+	uint32_t n;
+
+	if (avail > max) {
+		avail = max;
+	}
+
+	/* entries are read after head was */
+	__DMB();
+
+	for (n = 0; n < avail; n++) {
+		ts[n] = stream->buf[(tail + n) & stream->mask];
+	}
+
+	__DMB();
+	stream->tail = tail + avail;
+
+	return avail;
+}
@@ -0,0 +1,105 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <utimer.h>
+#include <utimer_pwm3.h>
+
+#define PWM3_COMPARE_CTRL	(COMPARE_CTRL_DRV_TOGGLE_AT_COMP_MATCH |	\
+				 COMPARE_CTRL_DRV_COMPARE_EN |			\
+				 COMPARE_CTRL_DRV_DRIVER_EN)
+
+static bool pwm3_timing_valid(uint32_t period, uint32_t dead_time,
+			uint32_t margin)
+{
+	/* compare B >= margin and at least one tick of on-time */
+	return margin != 0 && dead_time < period && margin < period - dead_time;
+}
+
+int32_t alif_utimer_pwm3_init(struct utimer_pwm3 *pwm,
+			const struct utimer_pwm3_config *cfg)
+{
+	struct utimer_channel_config ch = { 0 };
+	uint32_t base, i;
+
+	if (pwm == NULL || cfg == NULL || cfg->period < 2 ||
+	    cfg->period == UINT32_MAX ||
+	    !pwm3_timing_valid(cfg->period, cfg->dead_time, cfg->margin)) {
+		return -EINVAL;
+	}
+
+	pwm->glb_base = cfg->glb_base;
+	pwm->period = cfg->period;
+	pwm->dead_time = cfg->dead_time;
+	pwm->margin = cfg->margin;
+	pwm->chan_mask = 0;
+
+	/* 0 % duty: neither compare matches, A stays low and B high */
+	ch.cntr_ctrl = CNTR_CTRL_TRIANGLE_BUF_TROUGH_CREST;
+	ch.reload = cfg->period;
+	ch.compare[0] = alif_utimer_pwm3_compare(pwm, 0);
+	ch.compare[1] = alif_utimer_pwm3_compare_low(pwm, ch.compare[0]);
+	ch.compare_ctrl[0] = PWM3_COMPARE_CTRL;
+	ch.compare_ctrl[1] = PWM3_COMPARE_CTRL | COMPARE_CTRL_DRV_START_VAL_HIGH;
+	ch.int_mask = UINT32_MAX;
+	ch.soft_ctrl = true;
+
+	for (i = 0; i < UTIMER_PWM3_PHASES; i++) {
+		base = UTIMER_CHAN_BASE(cfg->glb_base, cfg->chan[i]);
+
+		pwm->chan[i] = cfg->chan[i];
+		pwm->chan_base[i] = base;
+		pwm->chan_mask |= (1U << cfg->chan[i]);
+		pwm->cmp_a[i] = (volatile uint32_t *)UTIMER_COMPARE_A(base);
+		pwm->cmp_b[i] = (volatile uint32_t *)UTIMER_COMPARE_B(base);
+
+		alif_utimer_disable_timer_output(cfg->glb_base, cfg->chan[i]);
+		alif_utimer_enable_timer_clock(cfg->glb_base, cfg->chan[i]);
+
+		alif_utimer_config_channel(base, &ch);
+	}
+
+	return 0;
+}
+
+void alif_utimer_pwm3_start(struct utimer_pwm3 *pwm)
+{
+	uint32_t i;
+
+	alif_utimer_clear_counters(pwm->glb_base, pwm->chan_mask);
+
+	for (i = 0; i < UTIMER_PWM3_PHASES; i++) {
+		alif_utimer_enable_driver_output(pwm->glb_base, 0, pwm->chan[i]);
+		alif_utimer_enable_driver_output(pwm->glb_base, 1, pwm->chan[i]);
+	}
+
+	alif_utimer_start_counters(pwm->glb_base, pwm->chan_mask);
+}
+
+void alif_utimer_pwm3_stop(struct utimer_pwm3 *pwm)
+{
+	uint32_t i;
+
+	alif_utimer_stop_counters(pwm->glb_base, pwm->chan_mask);
+
+	for (i = 0; i < UTIMER_PWM3_PHASES; i++) {
+		alif_utimer_disable_timer_output(pwm->glb_base, pwm->chan[i]);
+	}
+}
+
+int32_t alif_utimer_pwm3_set_dead_time(struct utimer_pwm3 *pwm,
+			uint32_t dead_time)
+{
+	if (!pwm3_timing_valid(pwm->period, dead_time, pwm->margin)) {
+		return -EINVAL;
+	}
+
+	pwm->dead_time = dead_time;
+
+	return 0;
+}
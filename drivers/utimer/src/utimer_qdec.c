@@ -0,0 +1,165 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <cmsis_core.h>
+#include <utimer.h>
+#include <utimer_qdec.h>
+
+int32_t alif_utimer_qdec_velocity(int32_t edges, uint32_t dt, uint32_t clk_hz)
+{
+	int64_t v;
+
+	if (dt == 0) {
+		return 0;
+	}
+
+	v = ((int64_t)edges * clk_hz) / dt;
+
+	if (v > INT32_MAX) {
+		return INT32_MAX;
+	}
+	if (v < INT32_MIN) {
+		return INT32_MIN;
+	}
+
+	return (int32_t)v;
+}
+
+int32_t alif_utimer_qdec_init(struct utimer_qdec *qdec,
+			const struct utimer_qdec_config *cfg)
+{
+	struct utimer_channel_config ch = { 0 };
+
+	if (qdec == NULL || cfg == NULL || cfg->sample_period == 0 ||
+	    cfg->clk_hz == 0 || cfg->idle_ticks == 0) {
+		return -EINVAL;
+	}
+
+	qdec->cfg = *cfg;
+	qdec->seq = 0;
+	qdec->position = 0;
+	qdec->velocity = 0;
+	qdec->last_cnt = 0;
+	qdec->last_edge = 0;
+	qdec->edge_valid = false;
+	qdec->dir = 0;
+	qdec->samples = 0;
+
+	/* encoder counter, wraps over the full 32 bit range */
+	ch.cntr_ctrl = CNTR_CTRL_SAWTOOTH;
+	ch.reload = UINT32_MAX;
+	ch.int_mask = UINT32_MAX;
+	ch.soft_ctrl = true;
+	alif_utimer_config_channel(cfg->qdec_base, &ch);
+	alif_utimer_config_qdec_triggers(cfg->qdec_base);
+
+	if (cfg->filter_prescaler) {
+		alif_utimer_enable_filter(cfg->qdec_base, cfg->filter_prescaler,
+					  cfg->filter_taps);
+	} else {
+		alif_utimer_disable_filter(cfg->qdec_base);
+	}
+
+	/* free running timestamp counter, compare A paces the samples */
+	ch.compare[0] = cfg->sample_period;
+	ch.compare_ctrl[0] = COMPARE_CTRL_DRV_COMPARE_EN;
+	ch.int_mask = ~CHAN_INTERRUPT_COMPARE_A_BUF1;
+	alif_utimer_config_channel(cfg->sample_base, &ch);
+
+	UTIMER_REG(UTIMER_TRIG_CAPTURE_SRC_A_0(cfg->sample_base)) = cfg->edge_src0;
+	UTIMER_REG(UTIMER_TRIG_CAPTURE_SRC_A_1(cfg->sample_base)) = cfg->edge_src1;
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT(cfg->sample_base)) = CHAN_INTERRUPT_COMPARE_A_BUF1;
+
+	return 0;
+}
+
+void alif_utimer_qdec_sample_isr(struct utimer_qdec *qdec)
+{
+	const struct utimer_qdec_config *cfg = &qdec->cfg;
+	uint32_t cnt, edge, now, age;
+	int32_t delta, v, bound;
+
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT(cfg->sample_base)) = CHAN_INTERRUPT_COMPARE_A_BUF1;
+	UTIMER_REG(UTIMER_COMPARE_A(cfg->sample_base)) += cfg->sample_period;
+
+	cnt = UTIMER_REG(UTIMER_CNTR(cfg->qdec_base));
+	edge = UTIMER_REG(UTIMER_CAPTURE_A(cfg->sample_base));
+	now = UTIMER_REG(UTIMER_CNTR(cfg->sample_base));
+
+	delta = (int32_t)(cnt - qdec->last_cnt);
+
+	if (delta != 0) {
+		if (qdec->edge_valid && edge != qdec->last_edge) {
+			/* T: last edge of the previous sample to the last edge now */
+			v = alif_utimer_qdec_velocity(delta, edge - qdec->last_edge,
+						      cfg->clk_hz);
+		} else if (qdec->edge_valid) {
+			v = alif_utimer_qdec_velocity(delta, now - qdec->last_edge,
+						      cfg->clk_hz);
+		} else {
+			/* no earlier edge, plain count over one sample */
+			v = alif_utimer_qdec_velocity(delta, cfg->sample_period,
+						      cfg->clk_hz);
+		}
+		qdec->last_edge = edge;
+		qdec->edge_valid = true;
+		qdec->dir = (delta > 0) ? 1 : -1;
+	} else if (qdec->edge_valid) {
+		age = now - qdec->last_edge;
+		if (age >= cfg->idle_ticks) {
+			v = 0;
+			qdec->edge_valid = false;
+		} else {
+			/* at most one count since the last edge */
+			v = qdec->velocity;
+			bound = alif_utimer_qdec_velocity(qdec->dir, age, cfg->clk_hz);
+			if ((v > 0 && v > bound) || (v < 0 && v < bound)) {
+				v = bound;
+			}
+		}
+	} else {
+		v = 0;
+	}
+
+	qdec->seq = qdec->seq + 1;
+	__DMB();
+	qdec->position += delta;
+	qdec->velocity = v;
+	qdec->last_cnt = cnt;
+	qdec->samples++;
+	__DMB();
+	qdec->seq = qdec->seq + 1;
+
+	if (cfg->cb != NULL) {
+		cfg->cb(qdec, cfg->user_data);
+	}
+}
+
+void alif_utimer_qdec_get(const struct utimer_qdec *qdec,
+			int64_t *position, int32_t *velocity)
+{
+	uint32_t seq;
+	int64_t pos;
+	int32_t vel;
+
+	do {
+		seq = qdec->seq;
+		__DMB();
+		pos = qdec->position;
+		vel = qdec->velocity;
+		__DMB();
+	} while ((seq & 1U) != 0 || seq != qdec->seq);
+
+	if (position != NULL) {
+		*position = pos;
+	}
+	if (velocity != NULL) {
+		*velocity = vel;
+	}
+}
@@ -0,0 +1,51 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <cmsis_core.h>
+#include <utimer.h>
+#include <utimer_timebase.h>
+
+void alif_utimer_timebase_init(struct utimer_timebase *tb, uint32_t reg_base)
+{
+	tb->reg_base = reg_base;
+	tb->period = (uint64_t)alif_utimer_get_counter_reload_value(reg_base) + 1;
+	tb->wraps = 0;
+}
+
+void alif_utimer_timebase_start(struct utimer_timebase *tb)
+{
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT(tb->reg_base)) = CHAN_INTERRUPT_OVER_FLOW;
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT_MASK(tb->reg_base)) &= ~CHAN_INTERRUPT_OVER_FLOW;
+}
+
+void alif_utimer_timebase_overflow_isr(struct utimer_timebase *tb)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	/* no reader may see the count and the status out of step */
+	__disable_irq();
+	tb->wraps = tb->wraps + 1;
+	UTIMER_REG(UTIMER_CHAN_INTERRUPT(tb->reg_base)) = CHAN_INTERRUPT_OVER_FLOW;
+	(void)UTIMER_REG(UTIMER_CHAN_INTERRUPT(tb->reg_base));
+	__set_PRIMASK(primask);
+}
+
+uint64_t alif_utimer_timebase_now(struct utimer_timebase *tb)
+{
+	uint32_t wraps, cnt;
+	bool pending;
+
+	do {
+		wraps = tb->wraps;
+		/* counter before status: a wrap in between is seen as pending */
+		cnt = UTIMER_REG(UTIMER_CNTR(tb->reg_base));
+		pending = (UTIMER_REG(UTIMER_CHAN_INTERRUPT(tb->reg_base)) &
+			   CHAN_INTERRUPT_OVER_FLOW) != 0;
+	} while (wraps != tb->wraps);
+
+	return alif_utimer_timebase_extend(wraps, cnt, pending, tb->period);
+}
@@ -0,0 +1,66 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdint.h>
+#include <cmsis_core.h>
+
+/*
+ * Cycle counts come from the DWT cycle counter, i.e. CPU clock cycles
+ * of the core running the benchmark. Each measurement is repeated and
+ * reported as min / average / max.
+ */
+
+struct bench_stat {
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint32_t n;
+};
+
+static inline void bench_cycles_init(void)
+{
+	DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t bench_cycles(void)
+{
+	return DWT->CYCCNT;
+}
+
+static inline void bench_stat_reset(struct bench_stat *s)
+{
+	s->min = UINT32_MAX;
+	s->max = 0;
+	s->sum = 0;
+	s->n = 0;
+}
+
+static inline void bench_stat_add(struct bench_stat *s, uint32_t cycles)
+{
+	if (cycles < s->min) {
+		s->min = cycles;
+	}
+	if (cycles > s->max) {
+		s->max = cycles;
+	}
+	s->sum += cycles;
+	s->n++;
+}
+
+/* One result line: name, min, average and max cycles */
+void bench_report(const char *name, const struct bench_stat *s);
+
+void bench_xip(void);
+void bench_hyperbus(void);
+void bench_ospi_call(void);
+void bench_resume(void);
+void bench_utimer_isr(void);
+
+#endif /* BENCH_H_ */
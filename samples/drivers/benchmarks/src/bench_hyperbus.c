@@ -0,0 +1,155 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq.h>
+#include <zephyr/sys/printk.h>
+#include "bench.h"
+#include "bench_ospi.h"
+
+/*
+ * HyperBus write cost, polling vs interrupt driven. Both paths write the
+ * same buffer: the three 16 bit Command/Address frames of a linear memory
+ * write followed by CONFIG_BENCH_HYPERBUS_FRAMES data frames.
+ *
+ * The polling path owns the CPU for the whole write. The interrupt driven
+ * path is timed from the call to the completion event plus the controller
+ * draining; of that, only the cycles spent in the OSPI ISR are CPU time.
+ */
+
+#define HB_RUNS         16
+#define HB_CA_FRAMES    3
+
+static uint32_t hb_buff[HB_CA_FRAMES + CONFIG_BENCH_HYPERBUS_FRAMES];
+
+static HAL_OSPI_Handle_T hb_handle;
+static volatile uint32_t hb_isr_cycles;
+static volatile uint32_t hb_irqs;
+
+static void hb_isr(const void *arg)
+{
+	uint32_t start = bench_cycles();
+
+	ARG_UNUSED(arg);
+
+	alif_hal_ospi_irq_handler(hb_handle);
+
+	hb_isr_cycles += bench_cycles() - start;
+	hb_irqs++;
+}
+
+/* CA[47]: write, CA[46]: memory space, CA[45]: linear burst */
+static void hb_fill(uint32_t addr)
+{
+	uint64_t ca;
+	uint32_t n;
+
+	addr /= 2;
+	ca = (1ULL << 45) | ((uint64_t)(addr >> 3) << 16) | (addr & 0x7);
+
+	hb_buff[0] = (uint32_t)(ca >> 32) & 0xFFFF;
+	hb_buff[1] = (uint32_t)(ca >> 16) & 0xFFFF;
+	hb_buff[2] = (uint32_t)ca & 0xFFFF;
+
+	for (n = 0; n < CONFIG_BENCH_HYPERBUS_FRAMES; n++) {
+		hb_buff[HB_CA_FRAMES + n] = n & 0xFFFF;
+	}
+}
+
+static uint32_t hb_poll(void)
+{
+	struct ospi_regs *regs = (struct ospi_regs *)BENCH_OSPI_REGS;
+	struct ospi_transfer transfer = {
+		.tx_total_cnt = ARRAY_SIZE(hb_buff),
+		.tx_buff = hb_buff,
+		.spi_frf = OSPI_FRF_OCTAL,
+		.dfs = 16,
+		.ddr = OSPI_DDR_ENABLE,
+		.inst_len = OSPI_INST_LENGTH_0_BITS,
+		.addr_len = OSPI_ADDR_LENGTH_0_BITS,
+		.dummy_cycle = CONFIG_BENCH_HYPERBUS_WAIT_CYCLES,
+	};
+	uint32_t start;
+
+	start = bench_cycles();
+	ospi_hyperbus_send(regs, &transfer);
+
+	return bench_cycles() - start;
+}
+
+static uint32_t hb_async(void)
+{
+	struct ospi_regs *regs = (struct ospi_regs *)BENCH_OSPI_REGS;
+	uint32_t start;
+
+	bench_ospi_events = 0;
+
+	start = bench_cycles();
+	if (alif_hal_ospi_hyperbus_send(hb_handle, hb_buff,
+					ARRAY_SIZE(hb_buff)) != OSPI_ERR_NONE) {
+		return 0;
+	}
+
+	while ((bench_ospi_events & OSPI_EVENT_TRANSFER_COMPLETE) == 0) {
+	}
+	while (ospi_busy(regs)) {
+	}
+
+	return bench_cycles() - start;
+}
+
+void bench_hyperbus(void)
+{
+	struct ospi_trans_config conf = {
+		.frame_size = 16,
+		.frame_format = OSPI_FRF_OCTAL,
+		.addr_len = OSPI_ADDR_LENGTH_0_BITS,
+		.inst_len = OSPI_INST_LENGTH_0_BITS,
+		.wait_cycles = CONFIG_BENCH_HYPERBUS_WAIT_CYCLES,
+		.ddr_enable = OSPI_DDR_ENABLE,
+	};
+	struct bench_stat poll, wall, isr, irqs;
+	uint32_t n;
+
+	if (bench_ospi_open(&hb_handle, NULL) != OSPI_ERR_NONE) {
+		return;
+	}
+
+	IRQ_CONNECT(DT_IRQN(BENCH_OSPI_NODE), DT_IRQ(BENCH_OSPI_NODE, priority),
+		    hb_isr, NULL, 0);
+	irq_enable(DT_IRQN(BENCH_OSPI_NODE));
+
+	alif_hal_ospi_prepare_transfer(hb_handle, &conf);
+	alif_hal_ospi_cs_enable(hb_handle, 1);
+
+	hb_fill(CONFIG_BENCH_HYPERBUS_ADDR);
+
+	bench_stat_reset(&poll);
+	for (n = 0; n < HB_RUNS; n++) {
+		bench_stat_add(&poll, hb_poll());
+	}
+
+	bench_stat_reset(&wall);
+	bench_stat_reset(&isr);
+	bench_stat_reset(&irqs);
+	for (n = 0; n < HB_RUNS; n++) {
+		hb_isr_cycles = 0;
+		hb_irqs = 0;
+		bench_stat_add(&wall, hb_async());
+		bench_stat_add(&isr, hb_isr_cycles);
+		bench_stat_add(&irqs, hb_irqs);
+	}
+
+	irq_disable(DT_IRQN(BENCH_OSPI_NODE));
+
+	bench_report("hyperbus poll", &poll);
+	bench_report("hyperbus irq wall", &wall);
+	bench_report("hyperbus irq isr", &isr);
+	printk("%-32s min %8u max %8u\n", "hyperbus irq count", irqs.min,
+	       irqs.max);
+
+	alif_hal_ospi_cs_enable(hb_handle, 0);
+	alif_hal_ospi_deinit(hb_handle);
+}
@@ -0,0 +1,49 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/sys/printk.h>
+#include "bench_ospi.h"
+
+volatile uint32_t bench_ospi_events;
+
+static void bench_ospi_event(uint32_t event, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	bench_ospi_events |= event;
+}
+
+int32_t bench_ospi_open(HAL_OSPI_Handle_T *handle,
+			const struct bench_ospi_profile *profile)
+{
+	struct ospi_init init = {
+		.bus_speed = CONFIG_BENCH_OSPI_BUS_SPEED,
+		.core_clk = CONFIG_BENCH_OSPI_CORE_CLK,
+		.cs_pin = CONFIG_BENCH_OSPI_CS_PIN,
+		.rx_sample_delay = CONFIG_BENCH_OSPI_RX_SAMPLE_DELAY,
+		.rx_ds_delay = CONFIG_BENCH_OSPI_RX_DS_DELAY,
+		.tx_fifo_threshold = 0,
+		.rx_fifo_threshold = 0,
+		.baud2_delay = OSPI_BAUD2_DELAY_AUTO,
+		.base_regs = (uint32_t *)BENCH_OSPI_REGS,
+		.aes_regs = (uint32_t *)BENCH_OSPI_AES,
+		.event_cb = bench_ospi_event,
+		.xip_wrap_cmd = CONFIG_BENCH_OSPI_XIP_CMD,
+		.xip_incr_cmd = CONFIG_BENCH_OSPI_XIP_CMD,
+		.xip_wait_cycles = CONFIG_BENCH_OSPI_XIP_WAIT_CYCLES,
+		.xip_rxds_vl_en = 0,
+		.xip_prefetch_en = profile ? profile->prefetch_en : 0,
+		.xip_cont_xfer_en = profile ? profile->cont_xfer_en : 0,
+		.xip_mbl = profile ? profile->mbl : 0,
+	};
+	int32_t ret;
+
+	ret = alif_hal_ospi_initialize(handle, &init);
+	if (ret != OSPI_ERR_NONE) {
+		printk("ospi%d init failed (%d)\n", CONFIG_BENCH_OSPI_INST, ret);
+	}
+
+	return ret;
+}
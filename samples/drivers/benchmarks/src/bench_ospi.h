@@ -0,0 +1,33 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#ifndef BENCH_OSPI_H_
+#define BENCH_OSPI_H_
+
+#include <stdint.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/util.h>
+#include "ospi_hal.h"
+
+#define BENCH_OSPI_NODE  DT_NODELABEL(UTIL_CAT(ospi, CONFIG_BENCH_OSPI_INST))
+#define BENCH_OSPI_REGS  DT_REG_ADDR_BY_IDX(BENCH_OSPI_NODE, 0)
+#define BENCH_OSPI_AES   DT_REG_ADDR_BY_IDX(BENCH_OSPI_NODE, 1)
+
+/* XiP read profile, see struct ospi_init */
+struct bench_ospi_profile {
+	const char *name;
+	uint16_t prefetch_en;
+	uint16_t cont_xfer_en;
+	uint16_t mbl;                   /* XIP_CTRL_XIP_MBL_x */
+};
+
+/* OSPI_EVENT_x reported since the last clear, set from the OSPI IRQ */
+extern volatile uint32_t bench_ospi_events;
+
+/* Claim the instance under test with the Kconfig settings and a profile */
+int32_t bench_ospi_open(HAL_OSPI_Handle_T *handle,
+			const struct bench_ospi_profile *profile);
+
+#endif /* BENCH_OSPI_H_ */
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include "bench.h"
+#include "bench_ospi.h"
+
+/*
+ * Per-call overhead of the HAL entry points, i.e. handle lookup and
+ * register block load around a trivial body. Run once with and once
+ * without CONFIG_ALIF_OSPI_DT_INSTANCES to compare the two instance
+ * tables. "call empty" is an out-of-line call doing nothing, the floor
+ * of the other lines. With the devicetree table, "call ospi<n>_irq_handler"
+ * is the per-node handler, which has no handle lookup.
+ */
+
+#define CALL_RUNS       1024
+
+static HAL_OSPI_Handle_T call_handle;
+
+static __noinline int32_t call_empty(HAL_OSPI_Handle_T handle)
+{
+	__asm__ volatile("" : : "r"(handle));
+
+	return OSPI_ERR_NONE;
+}
+
+static __noinline int32_t call_dma_addr(HAL_OSPI_Handle_T handle)
+{
+	volatile uint32_t *addr;
+
+	return alif_hal_ospi_get_dma_addr(handle, &addr);
+}
+
+static __noinline int32_t call_cs_disable(HAL_OSPI_Handle_T handle)
+{
+	return alif_hal_ospi_cs_enable(handle, 0);
+}
+
+static __noinline int32_t call_irq_idle(HAL_OSPI_Handle_T handle)
+{
+	return alif_hal_ospi_irq_handler(handle);
+}
+
+#ifdef CONFIG_ALIF_OSPI_DT_INSTANCES
+static __noinline int32_t call_irq_node_idle(HAL_OSPI_Handle_T handle)
+{
+	ARG_UNUSED(handle);
+
+	UTIL_CAT(UTIL_CAT(alif_hal_ospi, CONFIG_BENCH_OSPI_INST), _irq_handler)();
+
+	return OSPI_ERR_NONE;
+}
+#endif
+
+static const struct {
+	const char *name;
+	int32_t (*fn)(HAL_OSPI_Handle_T handle);
+} calls[] = {
+	{"call empty", call_empty},
+	{"call get_dma_addr", call_dma_addr},
+	{"call cs_enable(0)", call_cs_disable},
+	{"call irq_handler, idle", call_irq_idle},
+#ifdef CONFIG_ALIF_OSPI_DT_INSTANCES
+	{"call ospi<n>_irq_handler, idle", call_irq_node_idle},
+#endif
+};
+
+static void call_run(const char *name, int32_t (*fn)(HAL_OSPI_Handle_T handle))
+{
+	struct bench_stat stat;
+	unsigned int key;
+	uint32_t n, start, cycles;
+
+	bench_stat_reset(&stat);
+
+	for (n = 0; n < CALL_RUNS; n++) {
+		key = irq_lock();
+		start = bench_cycles();
+		fn(call_handle);
+		cycles = bench_cycles() - start;
+		irq_unlock(key);
+
+		bench_stat_add(&stat, cycles);
+	}
+
+	bench_report(name, &stat);
+}
+
+void bench_ospi_call(void)
+{
+	if (bench_ospi_open(&call_handle, NULL) != OSPI_ERR_NONE) {
+		return;
+	}
+
+	printk("instance table: %s\n",
+	       IS_ENABLED(CONFIG_ALIF_OSPI_DT_INSTANCES) ? "devicetree" : "runtime");
+
+	for (size_t i = 0; i < ARRAY_SIZE(calls); i++) {
+		call_run(calls[i].name, calls[i].fn);
+	}
+
+	alif_hal_ospi_deinit(call_handle);
+}
@@ -0,0 +1,118 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/cache.h>
+#include <zephyr/sys/printk.h>
+#include "bench.h"
+#include "bench_ospi.h"
+
+/*
+ * Controller bring-up on resume: alif_hal_ospi_initialize() followed by
+ * alif_hal_ospi_xip_enable(), against restoring a snapshot through the
+ * HAL and through ospi_restore_context() directly. Each run ends with
+ * the first XiP word load, checked against the value read before, so a
+ * restore that leaves XiP unusable shows up as a failure.
+ *
+ * Before every run the registers of the context are cleared, as by
+ * restoring an all-zero snapshot, so each path starts from a disabled
+ * controller with XiP off. That stands in for the register loss of a
+ * power down; the wake-up latency of the power domain itself is not
+ * part of the figures.
+ */
+
+#define RESUME_RUNS     64
+
+static struct ospi_context resume_ctx;
+static const struct ospi_context resume_lost;
+
+static void resume_power_down(struct ospi_regs *regs,
+			      struct ospi_aes_regs *aes)
+{
+	ospi_restore_context(regs, aes, &resume_lost);
+}
+
+static uint32_t resume_first_word(void)
+{
+	const volatile uint32_t *xip = (const volatile uint32_t *)CONFIG_BENCH_OSPI_XIP_BASE;
+
+	sys_cache_data_invd_range((void *)xip, sizeof(uint32_t));
+
+	return *xip;
+}
+
+void bench_resume(void)
+{
+	struct ospi_regs *regs = (struct ospi_regs *)BENCH_OSPI_REGS;
+	struct ospi_aes_regs *aes = (struct ospi_aes_regs *)BENCH_OSPI_AES;
+	struct bench_stat init, hal, ll;
+	HAL_OSPI_Handle_T handle;
+	uint32_t n, start, cycles, expect;
+	uint32_t bad = 0;
+
+	if (bench_ospi_open(&handle, NULL) != OSPI_ERR_NONE) {
+		return;
+	}
+	alif_hal_ospi_xip_enable(handle);
+	expect = resume_first_word();
+
+	bench_stat_reset(&init);
+	for (n = 0; n < RESUME_RUNS; n++) {
+		alif_hal_ospi_xip_disable(handle);
+		alif_hal_ospi_deinit(handle);
+		resume_power_down(regs, aes);
+
+		start = bench_cycles();
+		if (bench_ospi_open(&handle, NULL) != OSPI_ERR_NONE) {
+			return;
+		}
+		alif_hal_ospi_xip_enable(handle);
+		bad += resume_first_word() != expect;
+		cycles = bench_cycles() - start;
+
+		bench_stat_add(&init, cycles);
+	}
+
+	if (alif_hal_ospi_save_context(handle, &resume_ctx) != OSPI_ERR_NONE) {
+		printk("ospi save context failed\n");
+		alif_hal_ospi_xip_disable(handle);
+		alif_hal_ospi_deinit(handle);
+		return;
+	}
+
+	bench_stat_reset(&hal);
+	for (n = 0; n < RESUME_RUNS; n++) {
+		resume_power_down(regs, aes);
+
+		start = bench_cycles();
+		alif_hal_ospi_restore_context(handle, &resume_ctx);
+		bad += resume_first_word() != expect;
+		cycles = bench_cycles() - start;
+
+		bench_stat_add(&hal, cycles);
+	}
+
+	bench_stat_reset(&ll);
+	for (n = 0; n < RESUME_RUNS; n++) {
+		resume_power_down(regs, aes);
+
+		start = bench_cycles();
+		ospi_restore_context(regs, aes, &resume_ctx);
+		bad += resume_first_word() != expect;
+		cycles = bench_cycles() - start;
+
+		bench_stat_add(&ll, cycles);
+	}
+
+	bench_report("resume init + xip_enable", &init);
+	bench_report("resume hal restore_context", &hal);
+	bench_report("resume ospi_restore_context", &ll);
+	if (bad != 0) {
+		printk("resume: %u first XiP words differ\n", bad);
+	}
+
+	alif_hal_ospi_xip_disable(handle);
+	alif_hal_ospi_deinit(handle);
+}
@@ -0,0 +1,125 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include "bench.h"
+#include "utimer.h"
+
+/*
+ * Body of a UTIMER capture ISR, as in ble/plf/sync_timer.c: acknowledge
+ * CAPTURE_A, read back the pending register so the clear has landed, and
+ * read the captured and current counter. It runs with interrupts locked
+ * from a normal call, so only the accessor cost is measured, not the
+ * exception entry.
+ *
+ * "isr out-of-line" uses __noinline copies of the accessors, i.e. what
+ * the calls cost while they lived in utimer.c. "isr inline" takes the
+ * channel base at run time from the context, "isr inline chan" uses the
+ * alif_utimer_chan_* variants with a constant channel.
+ */
+
+#define UTIMER_ISR_RUNS         1024
+#define UTIMER_ISR_GLB_BASE     0x48000000U
+
+struct utimer_isr_ctx {
+	uint32_t base;
+	uint32_t capture;
+	uint32_t counter;
+};
+
+static __noinline void ool_ack_interrupts(uint32_t reg_base, uint32_t mask)
+{
+	alif_utimer_ack_interrupts(reg_base, mask);
+}
+
+static __noinline uint32_t ool_get_pending_interrupt(uint32_t reg_base)
+{
+	return alif_utimer_get_pending_interrupt(reg_base);
+}
+
+static __noinline uint32_t ool_get_capture_value(uint32_t reg_base, uint8_t driver)
+{
+	return alif_utimer_get_capture_value(reg_base, driver);
+}
+
+static __noinline uint32_t ool_get_counter_value(uint32_t reg_base)
+{
+	return alif_utimer_get_counter_value(reg_base);
+}
+
+static __noinline void isr_out_of_line(struct utimer_isr_ctx *ctx)
+{
+	uint32_t base = ctx->base;
+
+	ool_ack_interrupts(base, CHAN_INTERRUPT_CAPTURE_A);
+	(void)ool_get_pending_interrupt(base);
+
+	ctx->capture = ool_get_capture_value(base, 0);
+	ctx->counter = ool_get_counter_value(base);
+}
+
+static __noinline void isr_inline(struct utimer_isr_ctx *ctx)
+{
+	uint32_t base = ctx->base;
+
+	alif_utimer_ack_interrupts(base, CHAN_INTERRUPT_CAPTURE_A);
+	(void)alif_utimer_get_pending_interrupt(base);
+
+	ctx->capture = alif_utimer_get_capture_value(base, 0);
+	ctx->counter = alif_utimer_get_counter_value(base);
+}
+
+static __noinline void isr_inline_chan(struct utimer_isr_ctx *ctx)
+{
+	alif_utimer_chan_ack_interrupts(UTIMER_ISR_GLB_BASE, CONFIG_BENCH_UTIMER_CHAN,
+					CHAN_INTERRUPT_CAPTURE_A);
+	(void)alif_utimer_chan_get_pending_interrupt(UTIMER_ISR_GLB_BASE,
+						     CONFIG_BENCH_UTIMER_CHAN);
+
+	ctx->capture = alif_utimer_chan_get_capture_value(UTIMER_ISR_GLB_BASE,
+							  CONFIG_BENCH_UTIMER_CHAN, 0);
+	ctx->counter = alif_utimer_chan_get_counter_value(UTIMER_ISR_GLB_BASE,
+							  CONFIG_BENCH_UTIMER_CHAN);
+}
+
+static const struct {
+	const char *name;
+	void (*fn)(struct utimer_isr_ctx *ctx);
+} isrs[] = {
+	{"isr out-of-line", isr_out_of_line},
+	{"isr inline", isr_inline},
+	{"isr inline chan", isr_inline_chan},
+};
+
+void bench_utimer_isr(void)
+{
+	struct utimer_isr_ctx ctx = {
+		.base = UTIMER_CHAN_BASE(UTIMER_ISR_GLB_BASE, CONFIG_BENCH_UTIMER_CHAN),
+	};
+	struct bench_stat stat;
+	unsigned int key;
+	uint32_t n, start, cycles;
+
+	alif_utimer_enable_timer_clock(UTIMER_ISR_GLB_BASE, CONFIG_BENCH_UTIMER_CHAN);
+
+	for (size_t i = 0; i < ARRAY_SIZE(isrs); i++) {
+		bench_stat_reset(&stat);
+
+		for (n = 0; n < UTIMER_ISR_RUNS; n++) {
+			key = irq_lock();
+			start = bench_cycles();
+			isrs[i].fn(&ctx);
+			cycles = bench_cycles() - start;
+			irq_unlock(key);
+
+			bench_stat_add(&stat, cycles);
+		}
+
+		bench_report(isrs[i].name, &stat);
+	}
+
+	alif_utimer_disable_timer_clock(UTIMER_ISR_GLB_BASE, CONFIG_BENCH_UTIMER_CHAN);
+}
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/cache.h>
+#include <zephyr/sys/printk.h>
+#include "bench.h"
+#include "bench_ospi.h"
+
+/*
+ * XiP read cost per profile. A pass reads CONFIG_BENCH_XIP_BYTES through
+ * the XiP window with word loads after invalidating the range, so every
+ * line comes from the device. The latency test times single word loads
+ * of lines spread over 1 MiB, each invalidated first.
+ *
+ * The benchmark, its stack and data must not live in the XiP window of
+ * the instance under test: the window is switched between profiles.
+ */
+
+#define XIP_PASSES      8
+#define XIP_MISSES      256
+#define XIP_MISS_SPAN   (1024 * 1024)
+#define XIP_LINE        32
+
+static const struct bench_ospi_profile profiles[] = {
+	{"xip base", 0, 0, XIP_CTRL_XIP_MBL_2},
+	{"xip mbl4", 0, 0, XIP_CTRL_XIP_MBL_4},
+	{"xip mbl16", 0, 0, XIP_CTRL_XIP_MBL_16},
+	{"xip prefetch", 1, 0, XIP_CTRL_XIP_MBL_2},
+	{"xip cont", 0, 1, XIP_CTRL_XIP_MBL_2},
+	{"xip prefetch cont mbl16", 1, 1, XIP_CTRL_XIP_MBL_16},
+};
+
+static uint32_t xip_pass(const volatile uint32_t *src, uint32_t bytes)
+{
+	uint32_t sum = 0, start, n;
+
+	sys_cache_data_invd_range((void *)src, bytes);
+
+	start = bench_cycles();
+	for (n = 0; n < bytes / 4; n++) {
+		sum += src[n];
+	}
+	__DSB();
+
+	/* Keep the loads */
+	__asm__ volatile("" : : "r"(sum));
+
+	return bench_cycles() - start;
+}
+
+static uint32_t xip_miss(const volatile uint32_t *line)
+{
+	uint32_t start, val;
+
+	sys_cache_data_invd_range((void *)line, XIP_LINE);
+
+	start = bench_cycles();
+	val = *line;
+	__DSB();
+	__asm__ volatile("" : : "r"(val));
+
+	return bench_cycles() - start;
+}
+
+static void xip_profile(const struct bench_ospi_profile *profile)
+{
+	const volatile uint32_t *xip = (const volatile uint32_t *)CONFIG_BENCH_OSPI_XIP_BASE;
+	HAL_OSPI_Handle_T handle;
+	struct bench_stat pass, miss;
+	uint32_t n, seed = 1, offset;
+	char name[48];
+
+	if (bench_ospi_open(&handle, profile) != OSPI_ERR_NONE) {
+		return;
+	}
+
+	alif_hal_ospi_xip_enable(handle);
+
+	bench_stat_reset(&pass);
+	for (n = 0; n < XIP_PASSES; n++) {
+		bench_stat_add(&pass, xip_pass(xip, CONFIG_BENCH_XIP_BYTES));
+	}
+
+	bench_stat_reset(&miss);
+	for (n = 0; n < XIP_MISSES; n++) {
+		seed = seed * 1103515245U + 12345U;
+		offset = (seed >> 4) % XIP_MISS_SPAN & ~(XIP_LINE - 1U);
+		bench_stat_add(&miss, xip_miss(xip + offset / 4));
+	}
+
+	snprintk(name, sizeof(name), "%s %u B", profile->name, CONFIG_BENCH_XIP_BYTES);
+	bench_report(name, &pass);
+	snprintk(name, sizeof(name), "%s line miss", profile->name);
+	bench_report(name, &miss);
+
+	alif_hal_ospi_xip_disable(handle);
+	alif_hal_ospi_deinit(handle);
+}
+
+void bench_xip(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(profiles); i++) {
+		xip_profile(&profiles[i]);
+	}
+}
@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include "bench.h"
+
+void bench_report(const char *name, const struct bench_stat *s)
+{
+	if (s->n == 0) {
+		printk("%-32s no samples\n", name);
+		return;
+	}
+
+	printk("%-32s min %8u avg %8u max %8u cycles (n %u)\n", name, s->min,
+	       (uint32_t)(s->sum / s->n), s->max, s->n);
+}
+
+int main(void)
+{
+	bench_cycles_init();
+
+#ifdef CONFIG_BENCH_OSPI_XIP
+	bench_xip();
+#endif
+#ifdef CONFIG_BENCH_OSPI_HYPERBUS
+	bench_hyperbus();
+#endif
+#ifdef CONFIG_BENCH_OSPI_CALL
+	bench_ospi_call();
+#endif
+#ifdef CONFIG_BENCH_OSPI_RESUME
+	bench_resume();
+#endif
+#ifdef CONFIG_BENCH_UTIMER_ISR
+	bench_utimer_isr();
+#endif
+
+	printk("benchmarks done\n");
+
+	return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include "sync_drift.h"
+
+/* 10 ms ISO interval on a 160 MHz counter */
+#define NOMINAL 1600000U
+
+/*
+ * Synthetic capture stream: events every NOMINAL * (1 + ppb / 1e9)
+ * ticks, plus uniform jitter, taken as raw 32 bit counter values.
+ */
+struct gen {
+	double t;
+	double period;
+	uint32_t jitter;
+	uint32_t seed;
+};
+
+static struct sync_drift drift;
+static struct sync_drift_result res;
+
+static void gen_init(struct gen *g, double start, int32_t ppb, uint32_t jitter)
+{
+	g->t = start;
+	g->period = NOMINAL * (1.0 + ppb / 1e9);
+	g->jitter = jitter;
+	g->seed = 5;
+}
+
+static uint32_t gen_next(struct gen *g)
+{
+	int32_t j = 0;
+
+	if (g->jitter) {
+		g->seed = g->seed * 1103515245U + 12345U;
+		j = (int32_t)((g->seed >> 8) % (2 * g->jitter + 1)) - (int32_t)g->jitter;
+	}
+
+	g->t += g->period;
+	return (uint32_t)(uint64_t)(g->t + j);
+}
+
+static void feed(struct gen *g, uint32_t events)
+{
+	while (events--) {
+		sync_drift_update(&drift, gen_next(g));
+	}
+	sync_drift_get(&drift, &res);
+}
+
+static void sync_drift_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	sync_drift_init(&drift, NOMINAL);
+}
+
+ZTEST(sync_drift, test_idle_without_nominal)
+{
+	sync_drift_init(&drift, 0);
+	sync_drift_update(&drift, 1234);
+	sync_drift_get(&drift, &res);
+
+	zassert_equal(drift.updates, 0);
+	zassert_equal(res.period, 0);
+	zassert_false(res.locked);
+}
+
+ZTEST(sync_drift, test_nominal_locks)
+{
+	struct gen g;
+
+	gen_init(&g, 1000, 0, 0);
+	feed(&g, 200);
+
+	zassert_true(res.locked);
+	zassert_equal(res.ppb, 0);
+	zassert_equal(res.offset, 0);
+	zassert_equal(res.period, NOMINAL);
+	zassert_equal(drift.missed, 0);
+	zassert_equal(drift.rejected, 0);
+}
+
+ZTEST(sync_drift, test_tracks_drift_with_jitter)
+{
+	static const int32_t ppbs[] = {50000, -120000, 800000, -3000};
+	struct gen g;
+	uint32_t n;
+
+	for (n = 0; n < ARRAY_SIZE(ppbs); n++) {
+		sync_drift_init(&drift, NOMINAL);
+		gen_init(&g, 1000, ppbs[n], 40);
+		feed(&g, 2000);
+
+		zassert_true(res.locked);
+		zassert_within(res.ppb, ppbs[n], 2000, "ppb %d", ppbs[n]);
+		zassert_within(res.offset, 0, 20);
+		zassert_equal(drift.missed, 0);
+		zassert_equal(drift.rejected, 0);
+	}
+}
+
+ZTEST(sync_drift, test_pull_range_clamp)
+{
+	struct gen g;
+
+	/* Beyond the 1000 ppm pull range: clamped, never locked */
+	gen_init(&g, 1000, 3000000, 0);
+	feed(&g, 500);
+
+	zassert_equal(res.ppb, SYNC_DRIFT_MAX_PPM_DEFAULT * 1000);
+	zassert_false(res.locked);
+}
+
+ZTEST(sync_drift, test_counter_wrap)
+{
+	struct gen g;
+
+	/* Start a few events before the counter wraps, run through it */
+	gen_init(&g, 4294967296.0 - 5.5 * NOMINAL, 25000, 10);
+	feed(&g, 1000);
+	zassert_true(g.t > 4294967296.0);
+
+	zassert_true(res.locked);
+	zassert_within(res.ppb, 25000, 2000);
+	zassert_equal(drift.missed, 0);
+	zassert_equal(drift.rejected, 0);
+}
+
+ZTEST(sync_drift, test_missed_events)
+{
+	struct gen g;
+	uint32_t n;
+
+	gen_init(&g, 1000, 40000, 10);
+	feed(&g, 500);
+
+	/* Drop 1, 2, then 3 events in a row */
+	for (n = 1; n <= 3; n++) {
+		g.t += n * g.period;
+		feed(&g, 100);
+	}
+
+	zassert_equal(drift.missed, 6);
+	zassert_true(res.locked);
+	zassert_within(res.ppb, 40000, 2000);
+}
+
+ZTEST(sync_drift, test_spurious_capture_rejected)
+{
+	struct gen g;
+	uint32_t n;
+
+	gen_init(&g, 1000, -60000, 10);
+	feed(&g, 500);
+
+	/* Extra captures just after an event, well before the next one */
+	for (n = 0; n < 20; n++) {
+		feed(&g, 10);
+		sync_drift_update(&drift, (uint32_t)(uint64_t)g.t + NOMINAL / 3);
+	}
+	sync_drift_get(&drift, &res);
+
+	zassert_equal(drift.rejected, 20);
+	zassert_equal(drift.missed, 0);
+	zassert_true(res.locked);
+	zassert_within(res.ppb, -60000, 2000);
+}
+
+ZTEST(sync_drift, test_single_glitch_skipped)
+{
+	struct gen g;
+	uint32_t updates;
+
+	gen_init(&g, 1000, 10000, 0);
+	feed(&g, 500);
+	updates = drift.updates;
+
+	/* One late capture, inside half a period */
+	sync_drift_update(&drift, gen_next(&g) + NOMINAL / 3);
+	feed(&g, 20);
+
+	zassert_equal(drift.updates, updates + 20);
+	zassert_equal(drift.missed, 0);
+	zassert_true(res.locked);
+	zassert_within(res.ppb, 10000, 2000);
+}
+
+ZTEST(sync_drift, test_phase_step_reacquired)
+{
+	struct gen g;
+
+	gen_init(&g, 1000, 20000, 10);
+	feed(&g, 500);
+
+	/* The event source restarts a third of a period later */
+	g.t += NOMINAL / 3;
+	feed(&g, SYNC_DRIFT_MAX_OUTLIERS - 1);
+	zassert_false(res.locked);
+
+	feed(&g, 200);
+	zassert_true(res.locked);
+	zassert_within(res.offset, 0, 20);
+	zassert_within(res.ppb, 20000, 2000);
+}
+
+ZTEST_SUITE(sync_drift, NULL, NULL, sync_drift_before, NULL, NULL);
@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+/* Host stand-in for the PRIMASK intrinsics used by evtrtr.c */
+
+#ifndef TEST_CMSIS_CORE_H_
+#define TEST_CMSIS_CORE_H_
+
+#include <stdint.h>
+
+static uint32_t test_primask;
+
+static inline uint32_t __get_PRIMASK(void)
+{
+	return test_primask;
+}
+
+static inline void __set_PRIMASK(uint32_t mask)
+{
+	test_primask = mask;
+}
+
+static inline void __disable_irq(void)
+{
+	test_primask = 1;
+}
+
+#endif /* TEST_CMSIS_CORE_H_ */
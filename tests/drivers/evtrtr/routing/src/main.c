@@ -0,0 +1,173 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <errno.h>
+#include <zephyr/ztest.h>
+#include "evtrtr.h"
+
+/* The router and its clock gate are moved into memory for the test */
+static struct evtrtr_regs regs;
+static volatile uint32_t clk_reg;
+
+static void *evtrtr_setup(void)
+{
+	zassert_ok(alif_evtrtr_set_regs(EVTRTR_2, &regs, &clk_reg));
+
+	return NULL;
+}
+
+static void evtrtr_before(void *fixture)
+{
+	uint8_t chan;
+
+	ARG_UNUSED(fixture);
+
+	for (chan = 0; chan < EVTRTR_CHANNELS; chan++) {
+		while (alif_evtrtr_release(EVTRTR_2, chan) == 0)
+			;
+	}
+
+	zassert_equal(alif_evtrtr_claimed(EVTRTR_2), 0);
+}
+
+ZTEST(evtrtr, test_connect_programs_channel)
+{
+	clk_reg = 0;
+
+	zassert_ok(alif_evtrtr_connect(EVTRTR_2, 8, 2, 0));
+	zassert_equal(regs.DMA_CTRL[8], 2);
+	zassert_equal(regs.DMA_ACK_TYPE & (1U << 8), 0);
+	zassert_equal(clk_reg, EVTRTR2_CLK_EN);
+
+	zassert_ok(alif_evtrtr_connect(EVTRTR_2, 3, 1,
+			EVTRTR_ROUTE_DMA | EVTRTR_ROUTE_ACK_ROUTER));
+	zassert_equal(regs.DMA_CTRL[3],
+			1 | EVTRTR_DMA_CTRL_ENA);
+	zassert_equal(regs.DMA_ACK_TYPE & (1U << 3),
+			1U << 3);
+
+	zassert_equal(alif_evtrtr_claimed(EVTRTR_2), (1U << 8) | (1U << 3));
+
+	/* Last release turns the channel off, the clock stays on */
+	zassert_ok(alif_evtrtr_release(EVTRTR_2, 3));
+	zassert_equal(regs.DMA_CTRL[3], 0);
+	zassert_equal(regs.DMA_ACK_TYPE & (1U << 3), 0);
+	zassert_ok(alif_evtrtr_release(EVTRTR_2, 8));
+	zassert_equal(clk_reg, EVTRTR2_CLK_EN);
+}
+
+ZTEST(evtrtr, test_same_routing_is_shared)
+{
+	zassert_ok(alif_evtrtr_connect(EVTRTR_2, 5, 0, EVTRTR_ROUTE_DMA));
+	zassert_ok(alif_evtrtr_connect(EVTRTR_2, 5, 0, EVTRTR_ROUTE_DMA));
+
+	zassert_ok(alif_evtrtr_release(EVTRTR_2, 5));
+	zassert_equal(alif_evtrtr_claimed(EVTRTR_2), 1U << 5);
+	zassert_equal(regs.DMA_CTRL[5],
+			EVTRTR_DMA_CTRL_ENA);
+
+	zassert_ok(alif_evtrtr_release(EVTRTR_2, 5));
+	zassert_equal(alif_evtrtr_claimed(EVTRTR_2), 0);
+	zassert_equal(alif_evtrtr_release(EVTRTR_2, 5), -EINVAL);
+}
+
+ZTEST(evtrtr, test_conflicting_routing)
+{
+	zassert_ok(alif_evtrtr_connect(EVTRTR_2, 12, 1, EVTRTR_ROUTE_DMA));
+
+	zassert_equal(alif_evtrtr_connect(EVTRTR_2, 12, 2, EVTRTR_ROUTE_DMA),
+			-EBUSY);
+	zassert_equal(alif_evtrtr_connect(EVTRTR_2, 12, 1, 0), -EBUSY);
+	zassert_equal(alif_evtrtr_connect(EVTRTR_2, 12, 1,
+			EVTRTR_ROUTE_DMA | EVTRTR_ROUTE_ACK_ROUTER), -EBUSY);
+
+	/* A refused claim leaves the owner's routing alone */
+	zassert_equal(regs.DMA_CTRL[12],
+			1 | EVTRTR_DMA_CTRL_ENA);
+	zassert_ok(alif_evtrtr_release(EVTRTR_2, 12));
+	zassert_equal(alif_evtrtr_claimed(EVTRTR_2), 0);
+
+	/* Free again, any routing */
+	zassert_ok(alif_evtrtr_connect(EVTRTR_2, 12, 2, 0));
+}
+
+ZTEST(evtrtr, test_bad_parameters)
+{
+	zassert_equal(alif_evtrtr_connect(EVTRTR_2, EVTRTR_CHANNELS, 0, 0),
+			-EINVAL);
+	zassert_equal(alif_evtrtr_connect(EVTRTR_2, 0, EVTRTR_GROUPS, 0),
+			-EINVAL);
+	zassert_equal(alif_evtrtr_connect(EVTRTR_INSTANCES, 0, 0, 0), -EINVAL);
+	zassert_equal(alif_evtrtr_release(EVTRTR_2, EVTRTR_CHANNELS), -EINVAL);
+	zassert_equal(alif_evtrtr_release(EVTRTR_2, 0), -EINVAL);
+	zassert_equal(alif_evtrtr_claimed(EVTRTR_INSTANCES), 0);
+	zassert_equal(alif_evtrtr_set_regs(EVTRTR_INSTANCES, &regs, &clk_reg),
+			-EINVAL);
+	zassert_equal(alif_evtrtr_set_regs(EVTRTR_2, NULL, &clk_reg), -EINVAL);
+	zassert_equal(alif_evtrtr_set_regs(EVTRTR_2, &regs, NULL), -EINVAL);
+}
+
+ZTEST(evtrtr, test_set_regs_while_claimed)
+{
+	zassert_ok(alif_evtrtr_connect(EVTRTR_2, 0, 0, 0));
+	zassert_equal(alif_evtrtr_set_regs(EVTRTR_2, &regs, &clk_reg), -EBUSY);
+	zassert_ok(alif_evtrtr_release(EVTRTR_2, 0));
+	zassert_ok(alif_evtrtr_set_regs(EVTRTR_2, &regs, &clk_reg));
+}
+
+ZTEST(evtrtr, test_reference_limit)
+{
+	uint32_t n;
+
+	for (n = 0; n < UINT8_MAX; n++)
+		zassert_ok(alif_evtrtr_connect(EVTRTR_2, 31, 3, 0));
+
+	zassert_equal(alif_evtrtr_connect(EVTRTR_2, 31, 3, 0), -EBUSY);
+
+	for (n = 0; n < UINT8_MAX; n++)
+		zassert_ok(alif_evtrtr_release(EVTRTR_2, 31));
+
+	zassert_equal(alif_evtrtr_claimed(EVTRTR_2), 0);
+}
+
+ZTEST(evtrtr, test_random_claims)
+{
+	uint8_t refs[EVTRTR_CHANNELS] = {0};
+	uint8_t group[EVTRTR_CHANNELS] = {0};
+	uint32_t seed = 3, n, mask;
+	uint8_t chan, grp;
+	int32_t ret;
+
+	for (n = 0; n < 20000; n++) {
+		seed = seed * 1103515245U + 12345U;
+		chan = (seed >> 8) % EVTRTR_CHANNELS;
+		grp = (seed >> 16) % EVTRTR_GROUPS;
+
+		if ((seed >> 30) & 1) {
+			ret = alif_evtrtr_connect(EVTRTR_2, chan, grp, 0);
+			if (refs[chan] == 0 || group[chan] == grp) {
+				zassert_ok(ret);
+				group[chan] = grp;
+				refs[chan]++;
+			} else {
+				zassert_equal(ret, -EBUSY);
+			}
+		} else {
+			ret = alif_evtrtr_release(EVTRTR_2, chan);
+			zassert_equal(ret, refs[chan] ? 0 : -EINVAL);
+			if (refs[chan])
+				refs[chan]--;
+		}
+
+		mask = 0;
+		for (chan = 0; chan < EVTRTR_CHANNELS; chan++) {
+			if (refs[chan])
+				mask |= 1U << chan;
+		}
+		zassert_equal(alif_evtrtr_claimed(EVTRTR_2), mask);
+	}
+}
+
+ZTEST_SUITE(evtrtr, NULL, evtrtr_setup, evtrtr_before, NULL, NULL);
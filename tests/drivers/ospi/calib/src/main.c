@@ -0,0 +1,129 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include "ospi_calib.h"
+
+#define MAP_SMPL 32
+#define MAP_DS   16
+
+static uint8_t pass_map[MAP_SMPL * MAP_DS];
+
+/* ospi_calib_run() is not exercised, the window search is pure */
+int32_t alif_hal_ospi_set_rx_delays(HAL_OSPI_Handle_T handle,
+			uint8_t rx_sample_delay, uint8_t rx_ds_delay)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(rx_sample_delay);
+	ARG_UNUSED(rx_ds_delay);
+	return 0;
+}
+
+/* Passing rectangle [x0, x1] x [y0, y1] in an n_smpl x n_ds sweep */
+static void fill_window(uint32_t n_smpl, uint32_t n_ds, uint32_t x0,
+			uint32_t x1, uint32_t y0, uint32_t y1)
+{
+	uint32_t x, y;
+
+	memset(pass_map, 0, sizeof(pass_map));
+	for (y = y0; y <= y1 && y < n_ds; y++) {
+		for (x = x0; x <= x1 && x < n_smpl; x++)
+			pass_map[y * n_smpl + x] = 1;
+	}
+}
+
+ZTEST(ospi_calib, test_sample_delay_only_sweep)
+{
+	uint32_t smpl, ds;
+	int32_t margin;
+
+	/* n_ds == 1 must not give every point a zero margin */
+	fill_window(16, 1, 3, 12, 0, 0);
+	margin = ospi_calib_find_center(pass_map, 16, 1, &smpl, &ds);
+
+	zassert_equal(margin, 4);
+	zassert_between_inclusive(smpl, 7, 8);
+	zassert_equal(ds, 0);
+}
+
+ZTEST(ospi_calib, test_ds_delay_only_sweep)
+{
+	uint32_t smpl, ds;
+	int32_t margin;
+
+	fill_window(1, 16, 0, 0, 2, 9);
+	margin = ospi_calib_find_center(pass_map, 1, 16, &smpl, &ds);
+
+	zassert_equal(margin, 3);
+	zassert_equal(smpl, 0);
+	zassert_between_inclusive(ds, 5, 6);
+}
+
+ZTEST(ospi_calib, test_elongated_window)
+{
+	uint32_t smpl, ds;
+	int32_t margin;
+
+	/* Many points tie on margin 1, the middle of the window wins */
+	fill_window(MAP_SMPL, 8, 4, 27, 2, 4);
+	margin = ospi_calib_find_center(pass_map, MAP_SMPL, 8, &smpl, &ds);
+
+	zassert_equal(margin, 1);
+	zassert_between_inclusive(smpl, 15, 16);
+	zassert_equal(ds, 3);
+}
+
+ZTEST(ospi_calib, test_border_counts_as_failing)
+{
+	uint32_t smpl, ds;
+	int32_t margin;
+
+	/* Window touching the low corner, center pulled inside */
+	fill_window(MAP_SMPL, MAP_DS, 0, 6, 0, 6);
+	margin = ospi_calib_find_center(pass_map, MAP_SMPL, MAP_DS, &smpl, &ds);
+
+	zassert_equal(margin, 3);
+	zassert_equal(smpl, 3);
+	zassert_equal(ds, 3);
+}
+
+ZTEST(ospi_calib, test_hole_in_window)
+{
+	uint32_t smpl, ds;
+	int32_t margin;
+
+	fill_window(16, 1, 0, 15, 0, 0);
+	pass_map[5] = 0;
+	margin = ospi_calib_find_center(pass_map, 16, 1, &smpl, &ds);
+
+	zassert_equal(margin, 4);
+	zassert_between_inclusive(smpl, 10, 11);
+}
+
+ZTEST(ospi_calib, test_single_point)
+{
+	uint32_t smpl = 1, ds = 1;
+
+	fill_window(1, 1, 0, 0, 0, 0);
+	zassert_equal(ospi_calib_find_center(pass_map, 1, 1, &smpl, &ds), 0);
+	zassert_equal(smpl, 0);
+	zassert_equal(ds, 0);
+}
+
+ZTEST(ospi_calib, test_no_pass)
+{
+	uint32_t smpl, ds;
+
+	memset(pass_map, 0, sizeof(pass_map));
+	zassert_equal(ospi_calib_find_center(pass_map, MAP_SMPL, MAP_DS,
+			&smpl, &ds), OSPI_ERR_INVALID_STATE);
+	zassert_equal(ospi_calib_find_center(NULL, MAP_SMPL, MAP_DS,
+			&smpl, &ds), OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_calib_find_center(pass_map, 0, MAP_DS,
+			&smpl, &ds), OSPI_ERR_INVALID_PARAM);
+}
+
+ZTEST_SUITE(ospi_calib, NULL, NULL, NULL, NULL, NULL);
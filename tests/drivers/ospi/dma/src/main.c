@@ -0,0 +1,428 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include "ospi_hal.h"
+
+/*
+ * The controller is a plain struct ospi_regs in memory. A small model
+ * raises the interrupts the HAL unmasks: the Tx FIFO drains at once,
+ * and the Rx FIFO fills a threshold at a time once the command is out.
+ * The fake DMA engine moves frames through the FIFO address the HAL
+ * hands out and ends with alif_hal_ospi_dma_complete(), as a client's
+ * DMA completion callback would.
+ */
+
+#define RX_THRESHOLD   31U
+#define TX_DMA_LEVEL   64U
+#define RX_DMA_LEVEL   15U
+#define DMA_BURST      8U
+#define READ_FRAMES    4096U
+#define SEND_FRAMES    600U
+#define GUARD          0xA5A5A5A5U
+
+static struct ospi_regs regs;
+static struct ospi_aes_regs aes;
+static HAL_OSPI_Handle_T handle = -1;
+
+static uint32_t ospi_irqs;     /* OSPI interrupts taken */
+static uint32_t dma_irqs;      /* DMA completion interrupts */
+static uint32_t dma_requests;  /* DMA bursts, no CPU involved */
+static uint32_t events;
+static uint32_t last_event;
+
+static uint32_t cmd[2] = {0xEE11, 0x00010000};
+static uint32_t rx_buf[READ_FRAMES + 1];
+static uint32_t tx_buf[SEND_FRAMES];
+static uint32_t fifo_out[SEND_FRAMES];
+
+static void event_cb(uint32_t event, void *user_data)
+{
+	ARG_UNUSED(user_data);
+	events++;
+	last_event = event;
+}
+
+/* Frame n of the simulated flash */
+static uint32_t flash_word(uint32_t n)
+{
+	return 0x5A000000U ^ (n * 0x9E3779B1U);
+}
+
+/*
+ * Raise the interrupts the HAL has unmasked until it reports an event.
+ * Rx full fills RXFLR with the next RXFTLR + 1 frames, all reading back
+ * as the chunk's DR0 value.
+ */
+static void run_irqs(uint32_t rx_frames, uint32_t limit)
+{
+	uint32_t chunk = 0, level;
+
+	while (events == 0 && ospi_irqs < limit) {
+		regs.OSPI_ISR = 0;
+
+		if (regs.OSPI_IMR & SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK)
+			regs.OSPI_ISR |= SPI_TX_FIFO_EMPTY_EVENT;
+
+		level = 0;
+		if ((regs.OSPI_IMR & SPI_IMR_RX_FIFO_FULL_INTERRUPT_MASK) &&
+			!(regs.OSPI_IMR & SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK) &&
+			rx_frames != 0) {
+			level = regs.OSPI_RXFTLR + 1;
+			if (level > rx_frames)
+				level = rx_frames;
+
+			regs.OSPI_ISR |= SPI_RX_FIFO_FULL_EVENT;
+			regs.OSPI_DR0 = flash_word(chunk++);
+		}
+		regs.OSPI_RXFLR = level;
+
+		if (regs.OSPI_ISR == 0)
+			break;
+
+		ospi_irqs++;
+		zassert_ok(alif_hal_ospi_irq_handler(handle));
+
+		rx_frames -= level;
+		regs.OSPI_RXFLR = 0;
+	}
+}
+
+/* Client DMA on the Rx request: FIFO to buffer, DMARDLR + 1 per burst */
+static void fake_dma_rx(uint32_t *dst, uint32_t frames)
+{
+	volatile uint32_t *fifo;
+	uint32_t n, burst;
+
+	zassert_ok(alif_hal_ospi_get_dma_addr(handle, &fifo));
+	zassert_equal_ptr(fifo, &regs.OSPI_DR0);
+
+	burst = regs.OSPI_DMARDLR + 1;
+	for (n = 0; n < frames; n++) {
+		if (n % burst == 0)
+			dma_requests++;
+
+		regs.OSPI_DR0 = flash_word(n);
+		dst[n] = *fifo;
+	}
+
+	dma_irqs++;
+	zassert_ok(alif_hal_ospi_dma_complete(handle));
+}
+
+/* Client DMA on the Tx request: buffer to FIFO, DMA_BURST per burst */
+static void fake_dma_tx(const uint32_t *src, uint32_t frames)
+{
+	volatile uint32_t *fifo;
+	uint32_t n;
+
+	zassert_ok(alif_hal_ospi_get_dma_addr(handle, &fifo));
+
+	for (n = 0; n < frames; n++) {
+		if (n % DMA_BURST == 0)
+			dma_requests++;
+
+		*fifo = src[n];
+		fifo_out[n] = regs.OSPI_DR0;
+	}
+
+	dma_irqs++;
+	zassert_ok(alif_hal_ospi_dma_complete(handle));
+}
+
+static void ospi_dma_before(void *fixture)
+{
+	struct ospi_init init = {
+		.bus_speed = 50000000,
+		.core_clk = 400000000,
+		.rx_fifo_threshold = RX_THRESHOLD,
+		.tx_dma_level = TX_DMA_LEVEL,
+		.rx_dma_level = RX_DMA_LEVEL,
+		.baud2_delay = OSPI_BAUD2_DELAY_DISABLE,
+		.base_regs = (uint32_t *) &regs,
+		.aes_regs = (uint32_t *) &aes,
+		.event_cb = event_cb,
+	};
+	struct ospi_trans_config conf = {
+		.frame_size = 32,
+		.frame_format = OSPI_FRF_OCTAL,
+		.addr_len = OSPI_ADDR_LENGTH_32_BITS,
+		.inst_len = OSPI_INST_LENGTH_16_BITS,
+		.wait_cycles = 16,
+	};
+	uint32_t n;
+
+	ARG_UNUSED(fixture);
+
+	if (handle >= 0)
+		alif_hal_ospi_deinit(handle);
+
+	memset(&regs, 0, sizeof(regs));
+	memset(&aes, 0, sizeof(aes));
+
+	/* Idle: Tx FIFO empty, not busy */
+	regs.OSPI_SR = SPI_SR_TX_FIFO_EMPTY;
+
+	zassert_ok(alif_hal_ospi_initialize(&handle, &init));
+	zassert_ok(alif_hal_ospi_prepare_transfer(handle, &conf));
+
+	ospi_irqs = 0;
+	dma_irqs = 0;
+	dma_requests = 0;
+	events = 0;
+	last_event = 0;
+
+	for (n = 0; n < ARRAY_SIZE(rx_buf); n++)
+		rx_buf[n] = GUARD;
+	for (n = 0; n < ARRAY_SIZE(tx_buf); n++)
+		tx_buf[n] = flash_word(n);
+	memset(fifo_out, 0, sizeof(fifo_out));
+}
+
+ZTEST(ospi_dma, test_irq_transfer_baseline)
+{
+	uint32_t n;
+
+	zassert_ok(alif_hal_ospi_transfer(handle, cmd, rx_buf, READ_FRAMES));
+	run_irqs(READ_FRAMES, 10000);
+
+	zassert_equal(events, 1);
+	zassert_equal(last_event, OSPI_EVENT_TRANSFER_COMPLETE);
+
+	/* One for the command, then one per Rx threshold */
+	zassert_equal(ospi_irqs, 1 + READ_FRAMES / (RX_THRESHOLD + 1));
+
+	for (n = 0; n < READ_FRAMES; n++)
+		zassert_equal(rx_buf[n], flash_word(n / (RX_THRESHOLD + 1)));
+	zassert_equal(rx_buf[READ_FRAMES], GUARD);
+}
+
+ZTEST(ospi_dma, test_dma_transfer)
+{
+	uint32_t n;
+
+	zassert_ok(alif_hal_ospi_dma_transfer(handle, cmd, rx_buf, READ_FRAMES));
+
+	zassert_equal(regs.OSPI_CTRLR1, READ_FRAMES - 1);
+	zassert_equal(regs.OSPI_DMARDLR, RX_DMA_LEVEL);
+	zassert_equal(regs.OSPI_DMATDLR, TX_DMA_LEVEL);
+	zassert_equal(regs.OSPI_DMACR, SPI_DMACR_TDMAE | SPI_DMACR_RDMAE);
+	zassert_equal(regs.OSPI_ENR, OSPI_ENABLE);
+
+	/* Only error interrupts are left unmasked */
+	zassert_equal(regs.OSPI_IMR & (SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK |
+				SPI_IMR_RX_FIFO_FULL_INTERRUPT_MASK), 0);
+
+	fake_dma_rx(rx_buf, READ_FRAMES);
+	run_irqs(0, 10);
+
+	zassert_equal(events, 1);
+	zassert_equal(last_event, OSPI_EVENT_TRANSFER_COMPLETE);
+	zassert_equal(ospi_irqs, 0);
+	zassert_equal(dma_irqs, 1);
+	zassert_equal(dma_requests, READ_FRAMES / (RX_DMA_LEVEL + 1));
+
+	zassert_equal(regs.OSPI_DMACR, 0);
+	zassert_equal(regs.OSPI_ENR, OSPI_DISABLE);
+	zassert_equal(regs.OSPI_IMR, 0);
+
+	for (n = 0; n < READ_FRAMES; n++)
+		zassert_equal(rx_buf[n], flash_word(n));
+	zassert_equal(rx_buf[READ_FRAMES], GUARD);
+}
+
+ZTEST(ospi_dma, test_irq_send_baseline)
+{
+	zassert_ok(alif_hal_ospi_send(handle, tx_buf, SEND_FRAMES));
+	run_irqs(0, 100);
+
+	zassert_equal(events, 1);
+	zassert_equal(last_event, OSPI_EVENT_TRANSFER_COMPLETE);
+
+	/* One per FIFO refill, the last one also sees the FIFO drained */
+	zassert_equal(ospi_irqs,
+		(SEND_FRAMES + OSPI_TX_FIFO_DEPTH - 1) / OSPI_TX_FIFO_DEPTH);
+	zassert_equal(regs.OSPI_DR0, tx_buf[SEND_FRAMES - 1]);
+}
+
+ZTEST(ospi_dma, test_dma_send_longer_than_fifo)
+{
+	zassert_ok(alif_hal_ospi_dma_send(handle, tx_buf, SEND_FRAMES));
+
+	/* Start level is clamped to the FIFO, not taken from the length */
+	zassert_equal((regs.OSPI_TXFTLR & SPI_TXFTLR_TXFTHR_MASK) >>
+			SPI_TXFTLR_TXFTHR_SHIFT, OSPI_TX_FIFO_DEPTH - 1);
+	zassert_equal(regs.OSPI_DMATDLR, TX_DMA_LEVEL);
+	zassert_equal(regs.OSPI_DMACR, SPI_DMACR_TDMAE);
+	zassert_equal(regs.OSPI_IMR & SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK, 0);
+
+	fake_dma_tx(tx_buf, SEND_FRAMES);
+
+	/* Data is in the FIFO, not on the bus: no event yet */
+	zassert_equal(events, 0);
+	zassert_equal(regs.OSPI_DMACR, 0);
+	zassert_not_equal(regs.OSPI_IMR & SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK,
+			0);
+
+	/* One Tx FIFO empty interrupt reports the end */
+	run_irqs(0, 100);
+
+	zassert_equal(events, 1);
+	zassert_equal(last_event, OSPI_EVENT_TRANSFER_COMPLETE);
+	zassert_equal(ospi_irqs, 1);
+	zassert_equal(dma_irqs, 1);
+	zassert_equal(dma_requests,
+		(SEND_FRAMES + DMA_BURST - 1) / DMA_BURST);
+	zassert_mem_equal(fifo_out, tx_buf, sizeof(tx_buf));
+}
+
+ZTEST(ospi_dma, test_dma_busy_and_params)
+{
+	zassert_equal(alif_hal_ospi_dma_send(handle, tx_buf, 0),
+			OSPI_ERR_INVALID_PARAM);
+	zassert_equal(alif_hal_ospi_dma_transfer(handle, cmd, rx_buf, -1),
+			OSPI_ERR_INVALID_PARAM);
+	/* one past the last instance */
+	zassert_equal(alif_hal_ospi_dma_send(2, tx_buf, 1),
+			OSPI_ERR_INVALID_HANDLE);
+	zassert_equal(alif_hal_ospi_dma_send(-1, tx_buf, 1),
+			OSPI_ERR_INVALID_HANDLE);
+
+	regs.OSPI_SR = SPI_SR_BUSY;
+	zassert_equal(alif_hal_ospi_dma_transfer(handle, cmd, rx_buf, 16),
+			OSPI_ERR_CTRL_BUSY);
+	zassert_equal(regs.OSPI_DMACR, 0);
+}
+
+ZTEST_SUITE(ospi_dma, NULL, NULL, ospi_dma_before, NULL, NULL);
+
+/*
+ * Receive only read of 8 bit frames. The first Tx FIFO empty interrupt
+ * of a chunk sees the FIFO still busy, so the start level it sets for
+ * the command and address frames stays visible; the next one finds it
+ * drained. The chunk is then delivered at once, every frame reading back
+ * as the chunk number (8 bit frames arrive in pairs, see fifo_drain_8).
+ */
+static uint32_t run_receive(uint32_t *start_level, uint32_t *last_frame,
+			uint32_t max_chunks)
+{
+	uint32_t chunks = 0;
+	bool filled = false;
+
+	while (events == 0 && ospi_irqs < 16) {
+		regs.OSPI_SR = filled ? SPI_SR_TX_FIFO_EMPTY : 0;
+		regs.OSPI_RXFLR = 0;
+
+		if (regs.OSPI_IMR & SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK) {
+			regs.OSPI_ISR = SPI_TX_FIFO_EMPTY_EVENT;
+		} else if (regs.OSPI_IMR & SPI_IMR_RX_FIFO_FULL_INTERRUPT_MASK) {
+			regs.OSPI_ISR = SPI_RX_FIFO_FULL_EVENT;
+			regs.OSPI_RXFLR = regs.OSPI_CTRLR1 + 1;
+			regs.OSPI_DR0 = (chunks - 1) * 0x0101U;
+			filled = false;
+		} else {
+			break;
+		}
+
+		ospi_irqs++;
+		zassert_ok(alif_hal_ospi_irq_handler(handle));
+
+		if (regs.OSPI_ISR == SPI_TX_FIFO_EMPTY_EVENT && !filled) {
+			zassert_true(chunks < max_chunks);
+			start_level[chunks] = (regs.OSPI_TXFTLR &
+				SPI_TXFTLR_TXFTHR_MASK) >> SPI_TXFTLR_TXFTHR_SHIFT;
+			last_frame[chunks] = regs.OSPI_DR0;
+			chunks++;
+			filled = true;
+		}
+	}
+
+	regs.OSPI_SR = SPI_SR_TX_FIFO_EMPTY;
+
+	return chunks;
+}
+
+static void receive_check(uint32_t addr_len, uint32_t addr,
+			uint32_t cmd_frames, const uint32_t *last_frame_expect)
+{
+	static uint8_t buf[SPI_CTRLR1_NDF_MAX + 65];
+	struct ospi_trans_config conf = {
+		.frame_size = 8,
+		.frame_format = OSPI_FRF_OCTAL,
+		.addr_len = addr_len,
+		.inst_len = OSPI_INST_LENGTH_8_BITS,
+		.wait_cycles = 8,
+	};
+	uint32_t start_level[2], last_frame[2];
+	uint32_t n;
+
+	memset(buf, 0xA5, sizeof(buf));
+
+	zassert_ok(alif_hal_ospi_prepare_transfer(handle, &conf));
+	zassert_ok(alif_hal_ospi_receive(handle, 0x0B, addr, buf,
+			SPI_CTRLR1_NDF_MAX + 64));
+
+	zassert_equal(run_receive(start_level, last_frame, 2), 2);
+	zassert_equal(events, 1);
+	zassert_equal(last_event, OSPI_EVENT_TRANSFER_COMPLETE);
+
+	/* Command and address frames go out again for each chunk */
+	for (n = 0; n < 2; n++) {
+		zassert_equal(start_level[n], cmd_frames - 1);
+		zassert_equal(last_frame[n], last_frame_expect[n]);
+	}
+
+	zassert_equal(regs.OSPI_CTRLR1, 64 - 1);
+	for (n = 0; n < SPI_CTRLR1_NDF_MAX + 64; n++)
+		zassert_equal(buf[n], n < SPI_CTRLR1_NDF_MAX ? 0 : 1);
+	zassert_equal(buf[SPI_CTRLR1_NDF_MAX + 64], 0xA5);
+}
+
+ZTEST(ospi_dma, test_receive_chunks_addr_32bit)
+{
+	const uint32_t last[2] = {0x00123456, 0x00123456 + SPI_CTRLR1_NDF_MAX};
+
+	receive_check(OSPI_ADDR_LENGTH_32_BITS, 0x00123456, 2, last);
+}
+
+ZTEST(ospi_dma, test_receive_chunks_addr_24bit)
+{
+	/* Address bytes MSB first, so only the last one is left in DR0 */
+	const uint32_t last[2] = {0x56, 0x56};
+
+	receive_check(OSPI_ADDR_LENGTH_24_BITS, 0x00123456, 4, last);
+}
+
+ZTEST(ospi_dma, test_dma_entry_sets_fifo_kernels)
+{
+	static struct ospi_regs ll_regs;
+	struct ospi_transfer transfer;
+
+	/* A DMA transfer may be the first one on the instance */
+	memset(&transfer, 0, sizeof(transfer));
+	transfer.tx_buff = tx_buf;
+	transfer.tx_total_cnt = SEND_FRAMES;
+	ospi_dma_send(&ll_regs, &transfer);
+	zassert_not_null(transfer.tx_fill);
+	zassert_not_null(transfer.rx_drain);
+
+	memset(&transfer, 0, sizeof(transfer));
+	transfer.tx_buff = cmd;
+	transfer.tx_total_cnt = 2;
+	transfer.rx_buff = rx_buf;
+	transfer.rx_total_cnt = READ_FRAMES;
+	ospi_dma_transfer(&ll_regs, &transfer);
+	zassert_not_null(transfer.tx_fill);
+	zassert_not_null(transfer.rx_drain);
+
+	memset(&transfer, 0, sizeof(transfer));
+	transfer.tx_buff = tx_buf;
+	transfer.tx_total_cnt = SEND_FRAMES;
+	transfer.dfs = 16;
+	ospi_hyperbus_dma_send(&ll_regs, &transfer);
+	zassert_not_null(transfer.tx_fill);
+	zassert_not_null(transfer.rx_drain);
+}
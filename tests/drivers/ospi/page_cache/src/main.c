@@ -0,0 +1,195 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include "ospi_page_cache.h"
+
+#define FLASH_SIZE  0x4000U
+#define PAGE_SIZE   256U
+#define NUM_PAGES   4U
+
+/* Simulated flash array behind the backend read */
+static uint8_t flash[FLASH_SIZE];
+static uint32_t backend_reads;
+static int32_t backend_ret;
+
+static struct ospi_page_cache cache;
+static struct ospi_cache_page pages[NUM_PAGES];
+static uint8_t page_data[NUM_PAGES * PAGE_SIZE];
+
+static int32_t flash_read(void *ctx, uint32_t addr, void *buf, uint32_t len)
+{
+	zassert_equal_ptr(ctx, flash);
+	zassert_true(addr + len <= FLASH_SIZE);
+	zassert_equal(addr % PAGE_SIZE, 0);
+	zassert_equal(len, PAGE_SIZE);
+
+	backend_reads++;
+	if (backend_ret != OSPI_ERR_NONE)
+		return backend_ret;
+
+	memcpy(buf, &flash[addr], len);
+	return OSPI_ERR_NONE;
+}
+
+/* Program: the caller invalidates, as for the real flash */
+static void flash_program(uint32_t addr, uint8_t val, uint32_t len)
+{
+	memset(&flash[addr], val, len);
+	ospi_page_cache_invalidate(&cache, addr, len);
+}
+
+static void check_read(uint32_t addr, uint32_t len)
+{
+	static uint8_t buf[FLASH_SIZE];
+
+	zassert_ok(ospi_page_cache_read(&cache, addr, buf, len));
+	zassert_mem_equal(buf, &flash[addr], len);
+}
+
+static void page_cache_before(void *fixture)
+{
+	uint32_t n;
+
+	ARG_UNUSED(fixture);
+
+	for (n = 0; n < FLASH_SIZE; n++)
+		flash[n] = (uint8_t) (n * 7 + (n >> 8));
+
+	backend_reads = 0;
+	backend_ret = OSPI_ERR_NONE;
+
+	zassert_ok(ospi_page_cache_init(&cache, pages, page_data, PAGE_SIZE,
+				NUM_PAGES, flash_read, flash));
+}
+
+ZTEST(ospi_page_cache, test_init_params)
+{
+	struct ospi_page_cache c;
+
+	zassert_equal(ospi_page_cache_init(&c, pages, page_data, 96,
+				NUM_PAGES, flash_read, flash),
+			OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_page_cache_init(&c, pages, page_data, PAGE_SIZE,
+				0, flash_read, flash),
+			OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_page_cache_init(&c, pages, page_data, PAGE_SIZE,
+				NUM_PAGES, NULL, flash),
+			OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_page_cache_read(&cache, 0, NULL, 1),
+			OSPI_ERR_INVALID_PARAM);
+}
+
+ZTEST(ospi_page_cache, test_read_across_pages)
+{
+	/* Unaligned start, three pages */
+	check_read(PAGE_SIZE - 3, PAGE_SIZE + 6);
+
+	zassert_equal(cache.misses, 3);
+	zassert_equal(cache.hits, 0);
+	zassert_equal(backend_reads, 3);
+}
+
+ZTEST(ospi_page_cache, test_repeated_reads_hit)
+{
+	uint32_t n;
+
+	/* Metadata style: small reads of the same two pages */
+	for (n = 0; n < 100; n++) {
+		check_read(0x10 + (n % 8) * 4, 4);
+		check_read(0x1000 + (n % 16), 16);
+	}
+
+	zassert_equal(cache.misses, 2);
+	zassert_equal(cache.hits, 198);
+	zassert_equal(backend_reads, 2);
+
+	ospi_page_cache_reset_stats(&cache);
+	zassert_equal(cache.hits, 0);
+	zassert_equal(cache.misses, 0);
+}
+
+ZTEST(ospi_page_cache, test_lru_eviction)
+{
+	uint32_t n;
+
+	for (n = 0; n < NUM_PAGES; n++)
+		check_read(n * PAGE_SIZE, 1);
+
+	/* Page 0 becomes the most recent, page 1 the oldest */
+	check_read(0, 1);
+	check_read(NUM_PAGES * PAGE_SIZE, 1);
+	zassert_equal(backend_reads, NUM_PAGES + 1);
+
+	check_read(0, 1);
+	check_read(2 * PAGE_SIZE, 1);
+	zassert_equal(backend_reads, NUM_PAGES + 1);
+
+	check_read(PAGE_SIZE, 1);
+	zassert_equal(backend_reads, NUM_PAGES + 2);
+}
+
+ZTEST(ospi_page_cache, test_invalidate_on_program)
+{
+	check_read(0, 4 * PAGE_SIZE);
+	zassert_equal(backend_reads, 4);
+
+	/* Range straddles pages 1 and 2 */
+	flash_program(PAGE_SIZE + 200, 0x00, 100);
+
+	check_read(0, 4 * PAGE_SIZE);
+	zassert_equal(backend_reads, 6);
+
+	ospi_page_cache_invalidate_all(&cache);
+	check_read(3 * PAGE_SIZE, 1);
+	zassert_equal(backend_reads, 7);
+
+	/* Zero length drops nothing */
+	ospi_page_cache_invalidate(&cache, 3 * PAGE_SIZE, 0);
+	check_read(3 * PAGE_SIZE, 1);
+	zassert_equal(backend_reads, 7);
+}
+
+ZTEST(ospi_page_cache, test_backend_error)
+{
+	uint8_t buf[8];
+
+	check_read(0, 1);
+
+	backend_ret = OSPI_ERR_CTRL_BUSY;
+	zassert_equal(ospi_page_cache_read(&cache, PAGE_SIZE, buf, sizeof(buf)),
+			OSPI_ERR_CTRL_BUSY);
+
+	/* The failed page is not served later, the cached one still is */
+	backend_ret = OSPI_ERR_NONE;
+	check_read(PAGE_SIZE, sizeof(buf));
+	check_read(0, 1);
+	zassert_equal(backend_reads, 3);
+	zassert_equal(cache.hits, 1);
+}
+
+ZTEST(ospi_page_cache, test_random_against_flash)
+{
+	uint32_t seed = 1, n, addr, len;
+
+	for (n = 0; n < 20000; n++) {
+		seed = seed * 1103515245U + 12345U;
+		addr = (seed >> 8) % FLASH_SIZE;
+		len = 1 + (seed >> 4) % 600;
+		if (addr + len > FLASH_SIZE)
+			len = FLASH_SIZE - addr;
+
+		if ((seed >> 28) == 0)
+			flash_program(addr, (uint8_t) seed, len);
+		else
+			check_read(addr, len);
+	}
+
+	zassert_true(cache.hits != 0);
+	zassert_true(cache.misses != 0);
+}
+
+ZTEST_SUITE(ospi_page_cache, NULL, NULL, page_cache_before, NULL, NULL);
@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/ztest.h>
+#include "ospi_psram_heap.h"
+
+#define REGION_SIZE     16384U
+
+/* Stands in for the PSRAM XiP window, deliberately misaligned */
+static uint8_t region[REGION_SIZE + OSPI_PSRAM_ALIGN] __aligned(OSPI_PSRAM_ALIGN);
+static struct ospi_psram_heap heap;
+
+static const struct ospi_psram_pool_cfg pools[] = {
+	{ .block_size = 100, .num_blocks = 4 },
+	{ .block_size = 1024, .num_blocks = 2 },
+};
+
+static bool line_aligned(const void *ptr)
+{
+	return ((uintptr_t) ptr & (OSPI_PSRAM_ALIGN - 1)) == 0;
+}
+
+static void heap_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(ospi_psram_heap_init(&heap, region + 4, REGION_SIZE,
+			pools, ARRAY_SIZE(pools)), OSPI_ERR_NONE);
+}
+
+ZTEST(ospi_psram_heap, test_init_params)
+{
+	struct ospi_psram_heap h;
+	const struct ospi_psram_pool_cfg descending[] = {
+		{ .block_size = 256, .num_blocks = 1 },
+		{ .block_size = 64, .num_blocks = 1 },
+	};
+	const struct ospi_psram_pool_cfg too_big[] = {
+		{ .block_size = REGION_SIZE, .num_blocks = 2 },
+	};
+
+	zassert_equal(ospi_psram_heap_init(NULL, region, REGION_SIZE, NULL, 0),
+			OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_psram_heap_init(&h, region, REGION_SIZE, NULL, 1),
+			OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_psram_heap_init(&h, region, REGION_SIZE,
+			descending, 2), OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_psram_heap_init(&h, region, REGION_SIZE,
+			too_big, 1), OSPI_ERR_INVALID_PARAM);
+	zassert_equal(ospi_psram_heap_init(&h, region, REGION_SIZE, NULL, 0),
+			OSPI_ERR_NONE);
+}
+
+ZTEST(ospi_psram_heap, test_pool_size_classes)
+{
+	struct ospi_psram_stats stats;
+	void *small[4], *spill, *big;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		small[i] = ospi_psram_alloc(&heap, 64);
+		zassert_not_null(small[i]);
+		zassert_true(line_aligned(small[i]));
+	}
+
+	/* Smallest class exhausted, the next one serves */
+	spill = ospi_psram_alloc(&heap, 64);
+	zassert_not_null(spill);
+
+	ospi_psram_get_stats(&heap, &stats);
+	zassert_equal(stats.num_pools, 2);
+	zassert_equal(stats.pool_block_size[0], 128);
+	zassert_equal(stats.pool_in_use[0], 4);
+	zassert_equal(stats.pool_free[0], 0);
+	zassert_equal(stats.pool_in_use[1], 1);
+
+	big = ospi_psram_alloc(&heap, 1000);
+	zassert_not_null(big);
+
+	ospi_psram_free(&heap, small[2]);
+	ospi_psram_free(&heap, spill);
+	ospi_psram_free(&heap, big);
+
+	ospi_psram_get_stats(&heap, &stats);
+	zassert_equal(stats.pool_in_use[0], 3);
+	zassert_equal(stats.pool_peak[0], 4);
+	zassert_equal(stats.pool_in_use[1], 0);
+	zassert_equal(stats.pool_peak[1], 2);
+
+	/* The freed block comes back */
+	zassert_equal(ospi_psram_alloc(&heap, 100), small[2]);
+}
+
+ZTEST(ospi_psram_heap, test_heap_whole_lines)
+{
+	struct ospi_psram_stats stats;
+	uint8_t *a, *b, *c;
+
+	/* Larger than every size class, served by the heap */
+	a = ospi_psram_alloc(&heap, 2000);
+	b = ospi_psram_alloc(&heap, 1025);
+	c = ospi_psram_alloc(&heap, 1100);
+	zassert_not_null(a);
+	zassert_not_null(b);
+	zassert_not_null(c);
+	zassert_true(line_aligned(a) && line_aligned(b) && line_aligned(c));
+
+	/* No two blocks share a cache line */
+	zassert_true(b >= a + 2016 || a >= b + 1056);
+	zassert_true(c >= b + 1056 || b >= c + 1120);
+	zassert_true(c >= a + 2016 || a >= c + 1120);
+
+	ospi_psram_get_stats(&heap, &stats);
+	zassert_equal(stats.pool_in_use[0] + stats.pool_in_use[1], 0);
+	zassert_true(stats.heap_used >= 2016 + 1056 + 1120);
+
+	ospi_psram_free(&heap, a);
+	ospi_psram_free(&heap, b);
+	ospi_psram_free(&heap, c);
+
+	ospi_psram_get_stats(&heap, &stats);
+	zassert_equal(stats.heap_used, 0);
+	zassert_true(stats.heap_peak >= 2016 + 1056 + 1120);
+}
+
+ZTEST(ospi_psram_heap, test_exhaustion)
+{
+	struct ospi_psram_stats stats;
+	void *ptr;
+	int count = 0;
+
+	while ((ptr = ospi_psram_alloc(&heap, 512)) != NULL)
+		count++;
+
+	zassert_true(count > 2);
+	zassert_is_null(ospi_psram_alloc(&heap, REGION_SIZE));
+	zassert_is_null(ospi_psram_alloc(&heap, 0));
+
+	ospi_psram_get_stats(&heap, &stats);
+	zassert_equal(stats.alloc_fails, 2);
+	zassert_equal(stats.pool_free[1], 0);
+}
+
+ZTEST_SUITE(ospi_psram_heap, NULL, NULL, heap_before, NULL, NULL);
@@ -0,0 +1,16 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+/* Host stand-in for the barrier used by utimer_adc_ring.c */
+
+#ifndef TEST_CMSIS_CORE_H_
+#define TEST_CMSIS_CORE_H_
+
+static inline void __DMB(void)
+{
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#endif /* TEST_CMSIS_CORE_H_ */
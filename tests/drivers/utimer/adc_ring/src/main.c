@@ -0,0 +1,154 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <errno.h>
+#include <zephyr/ztest.h>
+#include "utimer_adc.h"
+
+/*
+ * The DMA is modelled by dma_put(): sample k, counted from 0, is the
+ * value k and lands in entry k % RING_SIZE. The count given to the
+ * reader is the number of samples put so far.
+ */
+
+#define RING_SIZE       8U
+
+static uint32_t buf[RING_SIZE];
+static uint64_t written;
+static struct utimer_adc_ring ring;
+
+static void dma_put(uint32_t n)
+{
+	while (n--) {
+		buf[written % RING_SIZE] = (uint32_t) written;
+		written++;
+	}
+}
+
+static void adc_ring_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	written = 0;
+	zassert_ok(alif_utimer_adc_ring_init(&ring, buf, RING_SIZE));
+}
+
+ZTEST(adc_ring, test_init_parameters)
+{
+	zassert_equal(alif_utimer_adc_ring_init(NULL, buf, RING_SIZE), -EINVAL);
+	zassert_equal(alif_utimer_adc_ring_init(&ring, NULL, RING_SIZE), -EINVAL);
+	zassert_equal(alif_utimer_adc_ring_init(&ring, buf, 1), -EINVAL);
+}
+
+ZTEST(adc_ring, test_read_across_wrap)
+{
+	uint32_t out[RING_SIZE];
+	uint32_t n, k, next = 0;
+	int32_t ret;
+
+	/* 5 samples per read, the reads cross the end of the ring */
+	for (n = 0; n < 10; n++) {
+		dma_put(5);
+		ret = alif_utimer_adc_ring_read(&ring, written, out, RING_SIZE);
+		zassert_equal(ret, 5);
+		for (k = 0; k < 5; k++)
+			zassert_equal(out[k], next++);
+	}
+
+	zassert_equal(ring.lost, 0);
+	zassert_equal(alif_utimer_adc_ring_read(&ring, written, out, RING_SIZE), 0);
+}
+
+ZTEST(adc_ring, test_partial_reads)
+{
+	uint32_t out[2];
+
+	dma_put(5);
+
+	zassert_equal(alif_utimer_adc_ring_read(&ring, written, out, 2), 2);
+	zassert_equal(out[0], 0);
+	zassert_equal(out[1], 1);
+	zassert_equal(alif_utimer_adc_ring_read(&ring, written, out, 2), 2);
+	zassert_equal(out[0], 2);
+	zassert_equal(alif_utimer_adc_ring_read(&ring, written, out, 2), 1);
+	zassert_equal(out[0], 4);
+	zassert_equal(ring.lost, 0);
+}
+
+ZTEST(adc_ring, test_full_ring_keeps_next_slot)
+{
+	uint32_t out[RING_SIZE];
+	int32_t ret;
+
+	/* a full lap: entry 0 was overwritten by sample 8 */
+	dma_put(RING_SIZE + 1);
+
+	ret = alif_utimer_adc_ring_read(&ring, written, out, RING_SIZE);
+	zassert_equal(ret, RING_SIZE - 1);
+	zassert_equal(ring.lost, 2);
+	zassert_equal(out[0], 2);
+	zassert_equal(out[RING_SIZE - 2], RING_SIZE);
+}
+
+ZTEST(adc_ring, test_overrun_many_laps)
+{
+	uint32_t out[RING_SIZE];
+	uint32_t k;
+	int32_t ret;
+
+	dma_put(3);
+	zassert_equal(alif_utimer_adc_ring_read(&ring, written, out, 1), 1);
+
+	dma_put(5 * RING_SIZE + 3);
+
+	ret = alif_utimer_adc_ring_read(&ring, written, out, RING_SIZE);
+	zassert_equal(ret, RING_SIZE - 1);
+	zassert_equal(ring.lost, written - 1 - (RING_SIZE - 1));
+	for (k = 0; k < (uint32_t) ret; k++)
+		zassert_equal(out[k], (uint32_t) written - (RING_SIZE - 1) + k);
+
+	/* back in step after the overrun */
+	dma_put(3);
+	zassert_equal(alif_utimer_adc_ring_read(&ring, written, out, RING_SIZE), 3);
+	zassert_equal(out[2], (uint32_t) written - 1);
+}
+
+ZTEST(adc_ring, test_count_behind_reader)
+{
+	uint32_t out[RING_SIZE];
+
+	dma_put(4);
+	zassert_equal(alif_utimer_adc_ring_read(&ring, written, out, RING_SIZE), 4);
+	zassert_equal(alif_utimer_adc_ring_read(&ring, 3, out, RING_SIZE), -EINVAL);
+}
+
+ZTEST(adc_ring, test_random_reads)
+{
+	uint32_t out[RING_SIZE];
+	uint64_t next = 0, lost = 0;
+	uint32_t seed = 7, n, k, put, max;
+	int32_t ret;
+
+	for (n = 0; n < 20000; n++) {
+		seed = seed * 1103515245U + 12345U;
+		put = (seed >> 8) % (2 * RING_SIZE);
+		max = (seed >> 16) % (RING_SIZE + 1);
+
+		dma_put(put);
+		ret = alif_utimer_adc_ring_read(&ring, written, out, max);
+		zassert_true(ret >= 0);
+
+		if (written - next > RING_SIZE - 1) {
+			lost += written - next - (RING_SIZE - 1);
+			next = written - (RING_SIZE - 1);
+		}
+		zassert_equal(ret, (written - next < max) ? written - next : max);
+		for (k = 0; k < (uint32_t) ret; k++)
+			zassert_equal(out[k], (uint32_t) next++);
+		zassert_equal(ring.lost, lost);
+	}
+}
+
+ZTEST_SUITE(adc_ring, NULL, NULL, adc_ring_before, NULL, NULL);
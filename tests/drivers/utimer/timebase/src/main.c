@@ -0,0 +1,154 @@
+/* SPDX-License-Identifier: Apache-2.0
+ *
+ * Copyright (C) 2024 Alif Semiconductor.
+ */
+
+#include <zephyr/ztest.h>
+#include "utimer_timebase.h"
+
+/*
+ * Simulated up counter wrapping every `period` ticks. The overflow
+ * status is set at each wrap, and the overflow interrupt runs `latency`
+ * ticks later, counting the wrap and clearing the status. Readers follow
+ * alif_utimer_timebase_now(): wrap count, counter, status, retried when
+ * the wrap count moved.
+ */
+struct sim {
+	uint64_t period;
+	uint64_t latency;
+};
+
+/* Wraps counted by the interrupt at time t */
+static uint32_t sim_wraps(const struct sim *s, uint64_t t)
+{
+	if (t < s->latency)
+		return 0;
+
+	return (uint32_t) ((t - s->latency) / s->period);
+}
+
+static uint32_t sim_cnt(const struct sim *s, uint64_t t)
+{
+	return (uint32_t) (t % s->period);
+}
+
+/* Status set from the wrap until the interrupt has served it */
+static bool sim_pending(const struct sim *s, uint64_t t)
+{
+	return t >= s->period && (t % s->period) < s->latency;
+}
+
+static uint32_t rand32(uint32_t *seed)
+{
+	*seed = *seed * 1103515245U + 12345U;
+	return *seed >> 1;
+}
+
+static uint64_t rand_below(uint32_t *seed, uint64_t n)
+{
+	uint64_t r = ((uint64_t) rand32(seed) << 31) | rand32(seed);
+
+	return (n == 0) ? 0 : r % n;
+}
+
+/* Time base read spread over [t, t + d1 + d2], returns the counter time */
+static uint64_t sim_now(const struct sim *s, uint64_t t, uint64_t d1,
+			uint64_t d2, uint64_t *value)
+{
+	uint32_t wraps, cnt;
+	bool pending;
+
+	for (;;) {
+		wraps = sim_wraps(s, t);
+		cnt = sim_cnt(s, t + d1);
+		pending = sim_pending(s, t + d1 + d2);
+		if (wraps == sim_wraps(s, t + d1 + d2))
+			break;
+		t += d1 + d2 + 1;
+	}
+
+	*value = alif_utimer_timebase_extend(wraps, cnt, pending, s->period);
+	return t + d1;
+}
+
+static void run_sim(uint64_t period, uint32_t seed, uint32_t reads)
+{
+	struct sim s = {.period = period};
+	uint64_t t, at, value, last = 0;
+	uint32_t n, d1, d2;
+
+	/* Served well within half a period, reads take up to an eighth */
+	s.latency = rand_below(&seed, period / 4 + 1);
+
+	/* Start a few wraps in, just before one */
+	t = period * 5 - 1 - rand_below(&seed, period / 8 + 1);
+
+	for (n = 0; n < reads; n++) {
+		d1 = rand_below(&seed, period / 16 + 1);
+		d2 = rand_below(&seed, period / 16 + 1);
+
+		at = sim_now(&s, t, d1, d2, &value);
+		zassert_equal(value, at, "period %llu latency %llu",
+			(unsigned long long) period,
+			(unsigned long long) s.latency);
+		zassert_true(value >= last);
+		last = value;
+
+		/* Mostly short steps, so every wrap is crossed up close */
+		t = at + 1 + rand_below(&seed, (n & 7) ? period / 5 : period);
+	}
+}
+
+ZTEST(utimer_timebase, test_extend_no_pending)
+{
+	zassert_equal(alif_utimer_timebase_extend(0, 0, false, 1000), 0);
+	zassert_equal(alif_utimer_timebase_extend(3, 999, false, 1000), 3999);
+	zassert_equal(alif_utimer_timebase_extend(UINT32_MAX, 5, false,
+				1ULL << 32),
+			((uint64_t) UINT32_MAX << 32) + 5);
+}
+
+ZTEST(utimer_timebase, test_extend_pending)
+{
+	/* Counter wrapped, interrupt not run yet: one more wrap */
+	zassert_equal(alif_utimer_timebase_extend(3, 2, true, 1000), 4002);
+	zassert_equal(alif_utimer_timebase_extend(3, 499, true, 1000), 4499);
+
+	/* Counter read before the wrap, status after: no extra wrap */
+	zassert_equal(alif_utimer_timebase_extend(3, 500, true, 1000), 3500);
+	zassert_equal(alif_utimer_timebase_extend(3, 999, true, 1000), 3999);
+}
+
+ZTEST(utimer_timebase, test_sim_full_range)
+{
+	run_sim(1ULL << 32, 1, 20000);
+}
+
+ZTEST(utimer_timebase, test_sim_arbitrary_wrap)
+{
+	static const uint64_t periods[] = {
+		3, 7, 1000, 0x12345, 999983, 0x80000001ULL, 0xFFFFFFFFULL,
+	};
+	uint32_t n;
+
+	for (n = 0; n < ARRAY_SIZE(periods); n++)
+		run_sim(periods[n], 7 + n, 20000);
+}
+
+ZTEST(utimer_timebase, test_sim_every_tick_small_period)
+{
+	struct sim s = {.period = 10, .latency = 4};
+	uint64_t t, at, value;
+
+	/*
+	 * A read from every tick, the status read one tick after the
+	 * counter. Reads overlapping the interrupt are retried later.
+	 */
+	for (t = 0; t < 1000; t++) {
+		at = sim_now(&s, t, 0, 1, &value);
+		zassert_equal(value, at);
+		zassert_true(at == t || (at % 10) == 5);
+	}
+}
+
+ZTEST_SUITE(utimer_timebase, NULL, NULL, NULL, NULL, NULL);